@@ -0,0 +1,169 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Minimal Benchmark Harness
+
+   Each case: untimed setup, timed body, repeated until the body has
+   run for at least `minTime` (large n usually needs one repetition).
+   Results are collected and written as one JSON document:
+
+     { "peak_rss_scope": "case" | "process",
+       "benchmarks": [ { "name", "n", "ops", "reps",
+                         "ns_per_op", "ops_per_sec", "peak_rss_kb",
+                         "extra": { ... } } ] }
+
+   peak_rss_kb is the resident high-water mark. On Linux it is reset
+   before each case ("case": that case's own peak, including whatever
+   the process already held). Where it cannot be reset it is the
+   process-wide peak so far and never goes down ("process").
+   "extra" holds case-specific numbers added with annotate() and is
+   omitted when there are none.
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+
+namespace dsa {
+namespace bench {
+
+// Linux: clear_refs "5" resets VmHWM; false where that is unavailable
+inline bool resetPeakRss() {
+#ifdef __linux__
+    ofstream f("/proc/self/clear_refs");
+    return static_cast<bool>(f << "5" << flush);
+#else
+    return false;
+#endif
+}
+
+inline long peakRssKb() {
+#ifdef __linux__
+    ifstream status("/proc/self/status");
+    string line;
+    while (getline(status, line))
+        if (line.compare(0, 6, "VmHWM:") == 0) return stol(line.substr(6));
+#endif
+#ifndef _WIN32
+    rusage ru{};
+    getrusage(RUSAGE_SELF, &ru);
+#ifdef __APPLE__
+    return ru.ru_maxrss / 1024;      // bytes on macOS
+#else
+    return ru.ru_maxrss;             // kilobytes on Linux
+#endif
+#else
+    return 0;
+#endif
+}
+
+// keeps the optimizer from discarding a computed value
+template <typename T>
+inline void doNotOptimize(const T& v) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(v) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &v;
+#endif
+}
+
+struct Result {
+    string name;
+    size_t n;
+    size_t ops;
+    int    reps;
+    double nsPerOp;
+    long   peakRssKb;
+    vector<pair<string, double>> extra;
+};
+
+class Runner {
+private:
+    vector<Result> results_;
+    double         minTimeSec_;
+    bool           perCaseRss_;
+
+public:
+    explicit Runner(double minTimeSec = 0.2)
+        : minTimeSec_(minTimeSec), perCaseRss_(resetPeakRss()) {}
+
+    // body returns the number of operations it performed
+    void run(const string& name, size_t n,
+             const function<void()>& setup, const function<size_t()>& body) {
+        using clock = chrono::steady_clock;
+        double totalNs = 0;
+        size_t totalOps = 0;
+        int reps = 0;
+        if (perCaseRss_) resetPeakRss();
+        do {
+            setup();
+            auto t0 = clock::now();
+            totalOps += body();
+            totalNs  += chrono::duration<double, nano>(clock::now() - t0).count();
+            reps++;
+        } while (totalNs < minTimeSec_ * 1e9 && reps < 1000);
+
+        Result r{name, n, totalOps / reps, reps,
+                 totalOps ? totalNs / totalOps : 0.0, peakRssKb(), {}};
+        results_.push_back(r);
+        cerr << "  " << name << " n=" << n << "  " << r.nsPerOp << " ns/op\n";
+    }
+
+    void run(const string& name, size_t n, const function<size_t()>& body) {
+        run(name, n, [] {}, body);
+    }
+
+    const vector<Result>& results() const { return results_; }
+
+    // attaches a number to the most recent run of `name` (no-op if it was skipped)
+    void annotate(const string& name, const string& key, double value) {
+        for (auto it = results_.rbegin(); it != results_.rend(); ++it)
+            if (it->name == name) { it->extra.emplace_back(key, value); return; }
+    }
+
+    string toJson() const {
+        ostringstream os;
+        os << "{\n  \"peak_rss_scope\": \"" << (perCaseRss_ ? "case" : "process") << "\",\n"
+           << "  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results_.size(); ++i) {
+            const Result& r = results_[i];
+            char num[64];
+            os << "    {\"name\": \"" << r.name << "\", \"n\": " << r.n
+               << ", \"ops\": " << r.ops << ", \"reps\": " << r.reps;
+            snprintf(num, sizeof num, "%.2f", r.nsPerOp);
+            os << ", \"ns_per_op\": " << num;
+            snprintf(num, sizeof num, "%.0f", r.nsPerOp > 0 ? 1e9 / r.nsPerOp : 0.0);
+            os << ", \"ops_per_sec\": " << num
+               << ", \"peak_rss_kb\": " << r.peakRssKb;
+            if (!r.extra.empty()) {
+                os << ", \"extra\": {";
+                for (size_t k = 0; k < r.extra.size(); ++k) {
+                    snprintf(num, sizeof num, "%.6g", r.extra[k].second);
+                    os << (k ? ", " : "") << "\"" << r.extra[k].first << "\": " << num;
+                }
+                os << "}";
+            }
+            os << "}" << (i + 1 < results_.size() ? ",\n" : "\n");
+        }
+        os << "  ]\n}\n";
+        return os.str();
+    }
+};
+
+} // namespace bench
+} // namespace dsa
+
+#endif // BENCH_HARNESS_H
@@ -0,0 +1,703 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Benchmark Suite
+
+   Runs every engine against synthetic decks of 1e3 … 1e7 questions
+   (powers of ten up to --max) and prints JSON to stdout or --out.
+
+   Usage:  dsa_bench [--max N] [--min N] [--only SUBSTR] [--out FILE]
+                     [--metrics FILE]   (engine metrics JSON, METRICS=1 builds)
+   Build:  make bench            (default --max 1e6)
+           make bench BENCH_MAX=10000000
+   ═══════════════════════════════════════════════════════════════════ */
+
+#include <fstream>
+#include <algorithm>
+#include <thread>
+#include <set>
+#include "bench_harness.h"
+#include "deck_generator.h"
+#include "question_hashmap.h"
+#include "flat_question_map.h"
+#include "concurrent_question_map.h"
+#include "revision_heap.h"
+#include "parametric_revision_heap.h"
+#include "revision_calendar.h"
+#include "concurrent_revision_queue.h"
+#include "question_trie.h"
+#include "topic_graph.h"
+#include "sorting_engine.h"
+#include "revision_engine.h"
+#include "revision_simulator.h"
+#include "analytics_engine.h"
+#include "question_table.h"
+#include "metrics.h"
+
+using namespace dsa;
+using namespace dsa::bench;
+
+// ── Size caps for cases that are quadratic or memory-bound ──
+static constexpr size_t INSERTION_SORT_CAP = 20000;      // O(n²)
+static constexpr size_t TRIE_CAP           = 1000000;    // ~100 B per indexed word
+static constexpr size_t GRAPH_CAP          = 1000000;    // vertices
+static constexpr size_t CONCURRENT_OPS     = 200000;     // per thread, per rep
+static constexpr int    ADVERSARIAL_BITS   = 12;         // 2^12 equal-djb2 keys
+static constexpr int    MAX_THREADS        = 64;
+static constexpr size_t HEAP_LAYOUT_MIN    = 100000;     // layouts differ once the heap leaves L2
+static constexpr size_t QUEUE_OPS          = 50000;      // pop + re-push pairs per thread, per rep
+static constexpr size_t QUEUE_CAP          = 1000000;    // questions preloaded into the queues
+
+struct Options {
+    size_t minN = 1000;
+    size_t maxN = 1000000;
+    string only;
+    string out;
+    string metricsOut;
+};
+
+static Options parseArgs(int argc, char* argv[]) {
+    Options o;
+    for (int i = 1; i < argc; ++i) {
+        string a = argv[i];
+        auto val = [&]() -> string {
+            if (i + 1 >= argc) throw runtime_error("missing value for " + a);
+            return argv[++i];
+        };
+        if      (a == "--max")  o.maxN = static_cast<size_t>(stod(val()));
+        else if (a == "--min")  o.minN = static_cast<size_t>(stod(val()));
+        else if (a == "--only") o.only = val();
+        else if (a == "--out")  o.out  = val();
+        else if (a == "--metrics") o.metricsOut = val();
+        else throw runtime_error("unknown option " + a);
+    }
+    return o;
+}
+
+// silences printAnalytics while it is being timed
+struct MuteCout {
+    streambuf* saved;
+    ostringstream sink;
+    MuteCout() : saved(cout.rdbuf(sink.rdbuf())) {}
+    ~MuteCout() { cout.rdbuf(saved); }
+};
+
+class Suite {
+private:
+    Runner&        runner_;
+    const Options& opt_;
+    EpochDay       today_;
+
+    bool enabled(const string& name) const {
+        return opt_.only.empty() || name.find(opt_.only) != string::npos;
+    }
+
+    void run(const string& name, size_t n, const function<void()>& setup,
+             const function<size_t()>& body) {
+        if (enabled(name)) runner_.run(name, n, setup, body);
+    }
+
+    void run(const string& name, size_t n, const function<size_t()>& body) {
+        run(name, n, [] {}, body);
+    }
+
+public:
+    Suite(Runner& r, const Options& o) : runner_(r), opt_(o), today_(DeckGenerator::REFERENCE_DAY) {}
+
+    // ── QuestionHashMap (chained) / FlatQuestionMap (open addressing) ──
+    template <typename Map>
+    void hashMap(const string& prefix, const vector<Question>& deck) {
+        size_t n = deck.size();
+        vector<string> keys;
+        keys.reserve(n);
+        for (const auto& q : deck) keys.push_back(q.id);
+        shuffle(keys.begin(), keys.end(), mt19937(7));
+
+        unique_ptr<Map> map;
+        run(prefix + ".put", n,
+            [&] { map.reset(new Map()); },
+            [&] { for (const auto& q : deck) map->put(q.id, q); return n; });
+
+        run(prefix + ".get", n, [&] {
+            size_t hits = 0;
+            for (const auto& k : keys) hits += map->get(k).first;
+            doNotOptimize(hits);
+            return n;
+        });
+
+        run(prefix + ".find", n, [&] {
+            size_t xp = 0;
+            for (const auto& k : keys)
+                if (const Question* q = map->find(k)) xp += static_cast<size_t>(q->xpEarned);
+            doNotOptimize(xp);
+            return n;
+        });
+
+        run(prefix + ".scanWhere", n, [&] {
+            size_t c = 0;
+            for (const Question& q : map->where([](const Question& q) { return q.difficulty == Difficulty::HARD; }))
+                c += static_cast<size_t>(q.streak);
+            doNotOptimize(c);
+            return n;
+        });
+
+        run(prefix + ".contains", n, [&] {
+            size_t hits = 0;
+            for (const auto& k : keys) hits += map->contains(k);
+            doNotOptimize(hits);
+            return n;
+        });
+
+        run(prefix + ".remove", n,
+            [&] {
+                if (map->size() == static_cast<int>(n)) return;
+                for (const auto& q : deck) map->put(q.id, q);
+            },
+            [&] { for (const auto& k : keys) map->remove(k); return n; });
+    }
+
+    // ── Hash distribution — chain stats per hasher on real and adversarial keys ──
+    template <typename Hasher>
+    void hashDistribution(const string& set, const vector<string>& keys) {
+        string name = string("hashdist.") + Hasher::NAME + "." + set;
+        unique_ptr<BasicQuestionHashMap<Hasher>> map;
+        Question blank;
+        run(name, keys.size(),
+            [&] { map.reset(new BasicQuestionHashMap<Hasher>()); },
+            [&] { for (const auto& k : keys) map->put(k, blank); return keys.size(); });
+        if (!map) return;
+        auto st = map->chainStats();
+        runner_.annotate(name, "buckets", st.buckets);
+        runner_.annotate(name, "empty_buckets", st.empty);
+        runner_.annotate(name, "max_chain", st.maxChain);
+        runner_.annotate(name, "collisions", st.collisions);
+    }
+
+    template <typename Hasher>
+    void hashDistributionSets(const vector<Question>& deck) {
+        vector<string> ids, jsIds, adversarial;
+        for (const auto& q : deck) ids.push_back(q.id);
+
+        // store.js style: Date.now().toString(36) + 5 random base-36 chars
+        mt19937_64 rng(11);
+        auto base36 = [](uint64_t v, size_t width) {
+            string s(width, '0');
+            for (size_t i = width; i-- > 0; v /= 36) s[i] = "0123456789abcdefghijklmnopqrstuvwxyz"[v % 36];
+            return s;
+        };
+        uint64_t ms = 1700000000000ULL;
+        for (size_t i = 0; i < deck.size(); ++i, ms += rng() % 3)
+            jsIds.push_back(base36(ms, 8) + base36(rng(), 5));
+
+        // "Az" and "BY" have equal djb2 state, so every concatenation does too
+        for (uint32_t m = 0; m < (1u << ADVERSARIAL_BITS); ++m) {
+            string k;
+            for (int b = 0; b < ADVERSARIAL_BITS; ++b) k += (m >> b & 1) ? "BY" : "Az";
+            adversarial.push_back(k);
+        }
+
+        hashDistribution<Hasher>("ids", ids);
+        hashDistribution<Hasher>("jsIds", jsIds);
+        hashDistribution<Hasher>("djb2Adversarial", adversarial);
+    }
+
+    // ── QuestionHashMap bulk loading: reserve + put, build ──
+    void bulkLoad(const vector<Question>& deck) {
+        size_t n = deck.size();
+        unique_ptr<QuestionHashMap> map;
+        vector<Question> copy;
+
+        run("hashmap.putReserved", n,
+            [&] { map.reset(new QuestionHashMap()); map->reserve(static_cast<int>(n)); },
+            [&] { for (const auto& q : deck) map->put(q.id, q); return n; });
+
+        run("hashmap.build", n,
+            [&] { map.reset(new QuestionHashMap()); copy = deck; },
+            [&] { map->build(move(copy)); return n; });
+    }
+
+    // ── QuestionHashMap secondary indexes vs full scan ──
+    void indexes(const vector<Question>& deck) {
+        size_t n = deck.size();
+        QuestionHashMap scan, indexed;
+        for (const auto& q : deck) scan.put(q.id, q);
+        indexed = scan;
+        indexed.enableIndexes();
+
+        IndexQuery iq = IndexQuery().withDifficulty(Difficulty::HARD)
+                                    .withStatus(QuestionStatus::NEEDS_REVISION)
+                                    .withSubject("Graphs");
+        run("index.queryScan", n, [&] { doNotOptimize(scan.count(iq)); return size_t(1); });
+        run("index.queryIndexed", n, [&] { doNotOptimize(indexed.count(iq)); return size_t(1); });
+
+        run("index.build", n,
+            [&] { indexed.disableIndexes(); },
+            [&] { indexed.enableIndexes(); return n; });
+
+        run("index.put", n,
+            [&] { indexed = QuestionHashMap(); indexed.enableIndexes(); },
+            [&] { for (const auto& q : deck) indexed.put(q.id, q); return n; });
+    }
+
+    // ── ConcurrentQuestionMap — 95% get / 5% put-or-remove, 1..cores threads ──
+    void concurrent(const vector<Question>& deck) {
+        size_t n = deck.size();
+        ConcurrentQuestionMap map;
+        for (const auto& q : deck) map.put(q.id, q);
+
+        int cores = max(1, min(MAX_THREADS, static_cast<int>(thread::hardware_concurrency())));
+        for (int t = 1; ; t = min(t * 2, cores)) {
+            run("concurrent.mixed95.t" + to_string(t), n, [&] {
+                vector<thread> workers;
+                for (int w = 0; w < t; ++w)
+                    workers.emplace_back([&, w] {
+                        mt19937_64 rng(static_cast<uint64_t>(w) * 7919 + 1);
+                        size_t hits = 0;
+                        for (size_t i = 0; i < CONCURRENT_OPS; ++i) {
+                            const Question& q = deck[rng() % n];
+                            uint64_t r = rng() % 100;
+                            if (r < 95)      hits += map.contains(q.id);
+                            else if (r & 1)  map.put(q.id, q);
+                            else             map.remove(q.id);
+                        }
+                        doNotOptimize(hits);
+                    });
+                for (auto& th : workers) th.join();
+                return CONCURRENT_OPS * static_cast<size_t>(t);
+            });
+            if (t == cores) break;
+        }
+    }
+
+    // ── Parallel revision dispatch: pop, reschedule a week out, push back ──
+    // multiqueue = ConcurrentRevisionQueue; locked = one RevisionHeap behind
+    // a mutex. Threads go 1 … MAX_THREADS even past the core count, to show
+    // how each queue behaves once workers are preempted.
+    void dispatch(const vector<Question>& deck) {
+        size_t n = min(deck.size(), QUEUE_CAP);
+        vector<Question> queued;
+        for (size_t i = 0; i < n; ++i)
+            if (deck[i].status != QuestionStatus::MASTERED && !deck[i].nextRevisionDate.empty())
+                queued.push_back(deck[i]);
+        if (queued.empty()) return;
+
+        unique_ptr<ConcurrentRevisionQueue> mq;
+        unique_ptr<RevisionHeap> locked;
+        mutex lockedMu;
+
+        for (int t = 1; t <= MAX_THREADS; t *= 2) {
+            auto work = [&](auto&& popPush) {
+                vector<thread> workers;
+                for (int w = 0; w < t; ++w)
+                    workers.emplace_back([&] {
+                        HeapEntry e;
+                        for (size_t i = 0; i < QUEUE_OPS; ++i) {
+                            if (!popPush(e)) break;
+                        }
+                    });
+                for (auto& th : workers) th.join();
+                return QUEUE_OPS * static_cast<size_t>(t);
+            };
+
+            run("dispatch.multiqueue.t" + to_string(t), n,
+                [&] {
+                    mq.reset(new ConcurrentRevisionQueue());
+                    for (const auto& q : queued) mq->push(q, today_);
+                },
+                [&] {
+                    return work([&](HeapEntry& e) {
+                        if (!mq->tryPop(e)) return false;
+                        e.question.nextRevisionDate = e.question.nextRevisionDate + 7;
+                        mq->push(e.question, today_);
+                        return true;
+                    });
+                });
+
+            run("dispatch.locked.t" + to_string(t), n,
+                [&] { locked.reset(new RevisionHeap(vector<Question>(queued), today_)); },
+                [&] {
+                    return work([&](HeapEntry& e) {
+                        {
+                            lock_guard<mutex> lk(lockedMu);
+                            if (locked->empty()) return false;
+                            e = locked->pop();
+                        }
+                        e.question.nextRevisionDate = e.question.nextRevisionDate + 7;
+                        lock_guard<mutex> lk(lockedMu);
+                        locked->push(e.question, today_);
+                        return true;
+                    });
+                });
+        }
+
+        // rank error of single-threaded pops against the exact order
+        ConcurrentRevisionQueue rq;
+        size_t sample = min<size_t>(queued.size(), 10000);
+        multiset<double> rest;
+        for (size_t i = 0; i < sample; ++i) {
+            rq.push(queued[i], today_);
+            rest.insert(queued[i].getPriorityScore(today_));
+        }
+        double sum = 0, worst = 0;
+        HeapEntry e;
+        while (rq.tryPop(e)) {
+            auto it = rest.lower_bound(e.priorityScore);
+            double r = static_cast<double>(distance(rest.begin(), it));
+            sum += r;
+            worst = max(worst, r);
+            rest.erase(it);
+        }
+        runner_.annotate("dispatch.multiqueue.t1", "lanes", static_cast<double>(rq.laneCount()));
+        runner_.annotate("dispatch.multiqueue.t1", "mean_rank_error", sum / sample);
+        runner_.annotate("dispatch.multiqueue.t1", "max_rank_error", worst);
+    }
+
+    // ── RevisionHeap ──
+    void heap(const vector<Question>& deck) {
+        size_t n = deck.size();
+        unique_ptr<RevisionHeap> h;
+
+        run("heap.build", n,
+            [&] { h.reset(); },
+            [&] { h.reset(new RevisionHeap(deck, today_)); return n; });
+        if (h && h->size() > 0)
+            runner_.annotate("heap.build", "bytes_per_entry",
+                             static_cast<double>(h->memoryBytes()) / h->size());
+
+        run("heap.buildBorrowed", n,
+            [&] { h.reset(); },
+            [&] { h.reset(new RevisionHeap(RevisionHeap::borrowing(deck, today_))); return n; });
+        if (h && h->size() > 0)
+            runner_.annotate("heap.buildBorrowed", "bytes_per_entry",
+                             static_cast<double>(h->memoryBytes()) / h->size());
+
+        run("heap.push", n,
+            [&] { h.reset(new RevisionHeap()); },
+            [&] {
+                size_t c = 0;
+                for (const auto& q : deck)
+                    if (q.status != QuestionStatus::MASTERED && !q.nextRevisionDate.empty()) {
+                        h->push(q, today_);
+                        c++;
+                    }
+                return c;
+            });
+
+        RevisionHeap built = RevisionHeap::borrowing(deck, today_);
+        run("heap.topK10", n, [&] {
+            for (int i = 0; i < 100; ++i) doNotOptimize(built.topK(10));
+            return size_t(100);
+        });
+
+        run("heap.forEachTop10", n, [&] {
+            double sum = 0;
+            for (int i = 0; i < 100; ++i)
+                built.forEachTop(10, [&](const Question&, double s) { sum += s; });
+            doNotOptimize(sum);
+            return size_t(100);
+        });
+
+        run("heap.pop", n,
+            [&] { h.reset(new RevisionHeap(built)); },
+            [&] {
+                size_t c = static_cast<size_t>(h->size());
+                while (!h->empty()) doNotOptimize(h->pop());
+                return c;
+            });
+
+        // revision loop: re-score one answered question per op. Edited
+        // copies are pushed back, so these run on a heap owning its deck.
+        RevisionHeap owning(deck, today_);
+        vector<Question> queued;
+        for (const auto& q : deck)
+            if (built.contains(q.id)) queued.push_back(q);
+        shuffle(queued.begin(), queued.end(), mt19937(3));
+        size_t updates = min<size_t>(queued.size(), 100000);
+        run("heap.updatePriority", n,
+            [&] { h.reset(new RevisionHeap(owning)); },
+            [&] {
+                for (size_t i = 0; i < updates; ++i) {
+                    Question q = queued[i];
+                    q.nextRevisionDate = q.nextRevisionDate + 7;
+                    h->updatePriority(q.id, q, today_);
+                }
+                return updates;
+            });
+
+        run("heap.remove", n,
+            [&] { h.reset(new RevisionHeap(built)); },
+            [&] {
+                for (size_t i = 0; i < updates; ++i) h->remove(queued[i].id);
+                return updates;
+            });
+    }
+
+    // ── Heap layouts — arity × key layout on a borrowed deck, no Question copies ──
+    template <typename Heap>
+    void heapLayout(const string& tag, const vector<Question>& deck) {
+        size_t n = deck.size();
+        if (n < HEAP_LAYOUT_MIN) return;
+        string base = "heaplayout." + tag;
+        unique_ptr<Heap> h;
+
+        run(base + ".build", n,
+            [&] { h.reset(); },
+            [&] { h.reset(new Heap(Heap::borrowing(deck, today_))); return n; });
+
+        run(base + ".push", n,
+            [&] { h.reset(new Heap(Heap::borrowing(deck))); },
+            [&] {
+                size_t c = 0;
+                for (const auto& q : deck)
+                    if (q.status != QuestionStatus::MASTERED && !q.nextRevisionDate.empty()) {
+                        h->push(q, today_);
+                        c++;
+                    }
+                return c;
+            });
+
+        run(base + ".pop", n,
+            [&] { h.reset(new Heap(Heap::borrowing(deck, today_))); },
+            [&] {
+                size_t c = static_cast<size_t>(h->size());
+                while (!h->empty()) h->discardTop();
+                return c;
+            });
+    }
+
+    void heapLayouts(const vector<Question>& deck) {
+        heapLayout<RevisionHeap>("d2", deck);
+        heapLayout<RevisionHeap4>("d4", deck);
+        heapLayout<RevisionHeap8>("d8", deck);
+        heapLayout<RevisionHeap4Split>("d4split", deck);
+        heapLayout<RevisionHeap8Split>("d8split", deck);
+    }
+
+    // ── ParametricRevisionHeap — day-independent keys ──
+    void parametric(const vector<Question>& deck) {
+        size_t n = deck.size();
+        unique_ptr<ParametricRevisionHeap> p;
+
+        run("parametric.build", n,
+            [&] { p.reset(); },
+            [&] { p.reset(new ParametricRevisionHeap(deck, today_)); return n; });
+
+        run("parametric.push", n,
+            [&] { p.reset(new ParametricRevisionHeap()); },
+            [&] { size_t c = 0; for (const auto& q : deck) c += p->push(q); return c; });
+
+        run("parametric.pop", n,
+            [&] { p.reset(new ParametricRevisionHeap(deck, today_)); },
+            [&] {
+                EpochDay day = today_;
+                size_t c = static_cast<size_t>(p->dueCount(day));
+                for (size_t i = 0; i < c; ++i) p->discardTop(day);
+                return c;
+            });
+
+        // what midnight costs: RevisionHeap rebuilds, the parametric heap
+        // moves the questions that came due into their classes and
+        // evaluates its six class fronts for the new day
+        run("midnight.heapRebuild", n, [&] {
+            RevisionHeap h = RevisionHeap::borrowing(deck, today_ + 1);
+            doNotOptimize(h.size());
+            return size_t(1);
+        });
+
+        run("midnight.parametricTop10", n,
+            [&] { p.reset(new ParametricRevisionHeap(deck, today_)); },
+            [&] {
+                for (int d = 1; d <= 100; ++d) doNotOptimize(p->topK(10, today_ + d));
+                return size_t(100);
+            });
+    }
+
+    // ── RevisionCalendar ──
+    void calendar(const vector<Question>& deck) {
+        size_t n = deck.size();
+        unique_ptr<RevisionCalendar> c;
+        size_t queued = RevisionCalendar(deck).size();
+
+        run("calendar.build", n,
+            [&] { c.reset(); },
+            [&] { c.reset(new RevisionCalendar(deck)); return n; });
+
+        run("calendar.push", n,
+            [&] { c.reset(new RevisionCalendar()); },
+            [&] {
+                size_t k = 0;
+                for (const auto& q : deck) k += c->push(&q);
+                return k;
+            });
+
+        run("calendar.pop", n,
+            [&] { c.reset(new RevisionCalendar(deck)); },
+            [&] {
+                while (!c->empty()) doNotOptimize(&c->pop(today_));
+                return queued;
+            });
+
+        // one drain per day, a year ahead of the earliest due day
+        run("calendar.dailyDrain", n,
+            [&] { c.reset(new RevisionCalendar(deck)); },
+            [&] {
+                size_t k = 0;
+                EpochDay first = c->nextDueDay();
+                for (int d = 0; d < 365 && !c->empty(); ++d)
+                    k += c->drainDueBy(first + d, [](const Question& q) { doNotOptimize(&q); });
+                return max<size_t>(k, 1);
+            });
+    }
+
+    // ── QuestionTrie ──
+    void trie(const vector<Question>& deck) {
+        size_t n = deck.size();
+        if (n > TRIE_CAP) return;
+        unique_ptr<QuestionTrie> t;
+
+        run("trie.insert", n,
+            [&] { t.reset(new QuestionTrie()); },
+            [&] { for (const auto& q : deck) t->insertQuestion(q); return n; });
+        if (t && t->getTotalWords() > 0)
+            runner_.annotate("trie.insert", "bytes_per_word",
+                             static_cast<double>(t->memoryBytes()) / t->getTotalWords());
+
+        static const vector<string> prefixes = {
+            "tw", "lon", "me", "val", "k", "wo", "co", "ed", "ho", "nu",
+            "ro", "tr", "mi", "pa", "ma", "bi", "le", "se", "cl", "ju"
+        };
+        run("trie.autocomplete", n, [&] {
+            size_t found = 0;
+            for (int r = 0; r < 50; ++r)
+                for (const auto& p : prefixes) found += t->autocomplete(p, 10).size();
+            doNotOptimize(found);
+            return size_t(50) * prefixes.size();
+        });
+
+        static const vector<string> typos = { "tow sum", "medain sorted", "edti distance", "lru cahce" };
+        run("trie.fuzzySearch", n, [&] {
+            size_t found = 0;
+            for (const auto& s : typos) found += t->fuzzySearch(s, 2).size();
+            doNotOptimize(found);
+            return typos.size();
+        });
+    }
+
+    // ── SortingEngine ──
+    void sorting(const vector<Question>& deck) {
+        size_t n = deck.size();
+        vector<Question> work;
+        auto fresh = [&] { work = deck; };
+        auto cmp   = comparators::byRevisionDate;
+
+        run("sort.mergeSort", n, fresh, [&] { SortingEngine::mergeSort(work, cmp); return n; });
+        run("sort.quickSort", n, fresh, [&] { SortingEngine::quickSort(work, cmp); return n; });
+        run("sort.heapSort",  n, fresh, [&] { SortingEngine::heapSort(work, cmp);  return n; });
+        run("sort.smartSort", n, fresh, [&] { SortingEngine::smartSort(work, cmp); return n; });
+        run("sort.countingSortByDifficulty", n, fresh,
+            [&] { SortingEngine::countingSortByDifficulty(work); return n; });
+        if (n <= INSERTION_SORT_CAP)
+            run("sort.insertionSort", n, fresh, [&] { SortingEngine::insertionSort(work, cmp); return n; });
+    }
+
+    // ── TopicGraph — random DAG, ~3 out-edges per vertex ──
+    void graph(size_t n) {
+        n = min(n, GRAPH_CAP);
+        if (!enabled("graph.")) return;
+        TopicGraph g;
+        mt19937 rng(11);
+        vector<string> names(n);
+        for (size_t i = 0; i < n; ++i) names[i] = "topic-" + to_string(i);
+        g.addTopic(names[0]);
+        for (size_t v = 1; v < n; ++v) {
+            int deg = 1 + static_cast<int>(rng() % 3);
+            for (int e = 0; e < deg; ++e)
+                g.addPrerequisite(names[rng() % v], names[v]);
+        }
+
+        run("graph.bfs", n, [&] { doNotOptimize(g.bfs(names[0]));  return n; });
+        run("graph.dfs", n, [&] { doNotOptimize(g.dfs(names[0]));  return n; });
+        run("graph.topologicalSortKahn", n, [&] { doNotOptimize(g.topologicalSortKahn()); return n; });
+        run("graph.topologicalSortDFS",  n, [&] { doNotOptimize(g.topologicalSortDFS());  return n; });
+    }
+
+    // ── RevisionEngine / AnalyticsEngine ──
+    void engines(const vector<Question>& deck) {
+        size_t n = deck.size();
+        run("revision.getDueToday", n, [&] {
+            doNotOptimize(RevisionEngine::getDueToday(deck, today_));
+            return n;
+        });
+
+        if (enabled("revision.getDueToday.table")) {
+            QuestionTable table(deck);
+            run("revision.getDueToday.table", n, [&] {
+                doNotOptimize(RevisionEngine::getDueToday(table, today_));
+                return n;
+            });
+        }
+
+        if (enabled("revision.simulateYear")) {
+            unique_ptr<RevisionSimulator> sim;
+            SimulationConfig cfg;
+            cfg.start = today_;
+            run("revision.simulateYear", n,
+                [&] { sim.reset(new RevisionSimulator(deck, cfg)); },
+                [&] { sim->run(); return n; });
+        }
+
+        run("analytics.printAnalytics", n, [&] {
+            MuteCout mute;
+            AnalyticsEngine::printAnalytics(deck);
+            return n;
+        });
+    }
+};
+
+int main(int argc, char* argv[]) {
+    try {
+        Options opt = parseArgs(argc, argv);
+        Runner runner;
+        Suite suite(runner, opt);
+
+        for (size_t n = opt.minN; n <= opt.maxN; n *= 10) {
+            cerr << "── n = " << n << " ──\n";
+            vector<Question> deck = DeckGenerator(42).generate(n);
+            suite.hashMap<QuestionHashMap>("hashmap", deck);
+            suite.hashMap<FlatQuestionMap>("flatmap", deck);
+            suite.hashDistributionSets<Djb2Hash>(deck);
+            suite.hashDistributionSets<WyHash>(deck);
+            suite.hashDistributionSets<SeededWyHash>(deck);
+            suite.bulkLoad(deck);
+            suite.indexes(deck);
+            suite.concurrent(deck);
+            suite.dispatch(deck);
+            suite.heap(deck);
+            suite.heapLayouts(deck);
+            suite.parametric(deck);
+            suite.calendar(deck);
+            suite.trie(deck);
+            suite.sorting(deck);
+            suite.graph(n);
+            suite.engines(deck);
+        }
+
+        string json = runner.toJson();
+        if (opt.out.empty()) {
+            cout << json;
+        } else {
+            ofstream f(opt.out);
+            if (!f) throw runtime_error("cannot write " + opt.out);
+            f << json;
+            cerr << "Results written to " << opt.out << "\n";
+        }
+
+        if (!opt.metricsOut.empty()) {
+            ofstream f(opt.metricsOut);
+            if (!f) throw runtime_error("cannot write " + opt.metricsOut);
+            f << metrics().toJson() << "\n";
+        }
+    } catch (const exception& e) {
+        cerr << "dsa_bench: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
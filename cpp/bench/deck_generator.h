@@ -0,0 +1,119 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Synthetic Deck Generator (benchmarks)
+
+   Deterministic decks of any size with the same shape as real ones:
+   subjects from the standard topic graph, a LeetCode-heavy platform
+   mix, multi-word problem names, 0–4 tags, and revision dates spread
+   around `today` so a realistic share of the deck is due.
+
+   Same seed → same deck on every run and every day: ids are native
+   QuestionId text derived from the seed (not the clock-seeded
+   generator) and `today` defaults to the fixed REFERENCE_DAY.
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef DECK_GENERATOR_H
+#define DECK_GENERATOR_H
+
+#include "dsa_core.h"
+#include <random>
+
+using namespace std;
+
+namespace dsa {
+
+class DeckGenerator {
+public:
+    static constexpr EpochDay REFERENCE_DAY = EpochDay::fromCivil(2025, 1, 1);
+
+private:
+    mt19937_64 rng_;
+    EpochDay   today_;
+    uint64_t   idBase_;      // shaped like QuestionId's counter: (seconds << 24)
+
+    static const vector<string>& subjects() {
+        static const vector<string> s = {
+            "Arrays", "Strings", "Mathematics", "Bit Manipulation", "Sorting",
+            "Binary Search", "Two Pointers", "Sliding Window", "Prefix Sum",
+            "Linked Lists", "Hashing", "Stack", "Queue", "Trees", "BST", "Heaps",
+            "Segment Trees", "Trie", "Graphs", "BFS / DFS", "Topological Sort",
+            "Shortest Path", "MST", "Disjoint Set (Union-Find)", "Recursion",
+            "Dynamic Programming", "Backtracking", "DP on Trees", "DP on Graphs",
+            "Greedy"
+        };
+        return s;
+    }
+
+    static const vector<string>& words() {
+        static const vector<string> w = {
+            "two", "sum", "longest", "substring", "without", "repeating",
+            "median", "sorted", "arrays", "valid", "parentheses", "merge",
+            "intervals", "kth", "largest", "element", "word", "ladder",
+            "course", "schedule", "coin", "change", "edit", "distance",
+            "house", "robber", "number", "islands", "rotate", "image",
+            "trapping", "rain", "water", "minimum", "window", "path",
+            "maximum", "subarray", "product", "binary", "tree", "level",
+            "order", "traversal", "serialize", "lru", "cache", "clone",
+            "graph", "palindrome", "partition", "jump", "game", "unique",
+            "paths", "climbing", "stairs", "search", "rotated", "matrix"
+        };
+        return w;
+    }
+
+    int uniform(int lo, int hi) {
+        return uniform_int_distribution<int>(lo, hi)(rng_);
+    }
+
+public:
+    explicit DeckGenerator(uint64_t seed = 42, EpochDay today = REFERENCE_DAY)
+        : rng_(seed), today_(today),
+          idBase_((static_cast<uint64_t>(today.days) * 86400 + seed % 86400) << 24) {}
+
+    EpochDay today() const { return today_; }
+
+    // sequential per deck, like ids from one QuestionId::next() thread
+    Question next(size_t serial) {
+        const auto& w = words();
+        Question q;
+        q.id   = QuestionId(idBase_ + serial).toString();
+        q.name = w[uniform(0, static_cast<int>(w.size()) - 1)] + " " +
+                 w[uniform(0, static_cast<int>(w.size()) - 1)] + " " +
+                 w[uniform(0, static_cast<int>(w.size()) - 1)] + " " + to_string(serial);
+        q.subject  = subjects()[uniform(0, static_cast<int>(subjects().size()) - 1)];
+        int p = uniform(0, 9);
+        q.platform = p < 6 ? "LeetCode" : p < 8 ? "GeeksforGeeks" : p < 9 ? "Codeforces" : "HackerRank";
+        q.difficulty = static_cast<Difficulty>(uniform(0, 2));
+
+        int s = uniform(0, 99);
+        q.status = s < 10 ? QuestionStatus::UNSOLVED
+                 : s < 55 ? QuestionStatus::SOLVED
+                 : s < 85 ? QuestionStatus::NEEDS_REVISION
+                 :          QuestionStatus::MASTERED;
+
+        if (q.status != QuestionStatus::UNSOLVED) {
+            q.dateSolved       = today_ - uniform(1, 365);
+            q.revisionCycle    = uniform(0, 6);
+            q.streak           = uniform(0, 8);
+            q.easeFactor       = 1.3 + uniform(0, 17) / 10.0;
+            q.xpEarned         = uniform(10, 400);
+            q.nextRevisionDate = today_ + uniform(-30, 60);
+            if (q.revisionCycle > 0)
+                q.lastRevisionDate = q.nextRevisionDate - uniform(1, 30);
+        }
+
+        int nTags = uniform(0, 4);
+        for (int i = 0; i < nTags; ++i)
+            q.tags.push_back(Symbol::intern(w[uniform(0, static_cast<int>(w.size()) - 1)]));
+        return q;
+    }
+
+    vector<Question> generate(size_t n) {
+        vector<Question> deck;
+        deck.reserve(n);
+        for (size_t i = 0; i < n; ++i) deck.push_back(next(i));
+        return deck;
+    }
+};
+
+} // namespace dsa
+
+#endif // DECK_GENERATOR_H
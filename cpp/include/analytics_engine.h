@@ -9,6 +9,7 @@
 #define ANALYTICS_ENGINE_H
 
 #include "dsa_core.h"
+#include "question_table.h"
 #include <unordered_map>
 #include <cmath>
 #include <numeric>
@@ -61,12 +62,12 @@ public:
 
         double efSum = 0.0;
         int efCount = 0;
-        unordered_map<string, int> topicCount;
+        vector<int> topicCount(symbols().size(), 0);   // indexed by Symbol::id
         unordered_map<string, int> diffCount;
 
         for (const auto& q : questions) {
             // topic distribution
-            topicCount[q.subject]++;
+            topicCount[q.subject.id]++;
 
             // difficulty distribution
             diffCount[difficultyToString(q.difficulty)]++;
@@ -85,8 +86,7 @@ public:
 
         a.averageEaseFactor = efCount > 0 ? efSum / efCount : 2.5;
 
-        for (auto& kv : topicCount)
-            a.topicDistribution.emplace_back(kv.first, kv.second);
+        appendTopicCounts(topicCount, a.topicDistribution);
         for (auto& kv : diffCount)
             a.difficultyDistribution.emplace_back(kv.first, kv.second);
 
@@ -103,14 +103,68 @@ public:
         return a;
     }
 
+    // ── Columnar variant — scans packed columns, no Question copies ──
+
+    static Analytics computeAnalytics(const QuestionTable& table) {
+        Analytics a;
+        const QuestionTable::RowId n = table.size();
+        a.totalQuestions = static_cast<int>(n);
+
+        const uint8_t* diff  = table.difficultyColumn().data();
+        const uint8_t* st    = table.statusColumn().data();
+        const double*  ef    = table.easeFactorColumn().data();
+        const int32_t* cycle = table.revisionCycleColumn().data();
+        const int32_t* xp    = table.xpEarnedColumn().data();
+
+        int    diffCount[3]   = {0, 0, 0};
+        int    statusCount[4] = {0, 0, 0, 0};
+        double efSum = 0.0;
+        int    efCount = 0;
+        long long xpSum = 0, revSum = 0;
+
+        for (QuestionTable::RowId i = 0; i < n; ++i) {
+            diffCount[diff[i]]++;
+            statusCount[st[i]]++;
+            bool revised = cycle[i] > 0;
+            efSum   += revised ? ef[i] : 0.0;
+            efCount += revised;
+            xpSum   += xp[i];
+            revSum  += cycle[i];
+        }
+
+        a.masteredCount      = statusCount[static_cast<int>(QuestionStatus::MASTERED)];
+        a.needsRevisionCount = statusCount[static_cast<int>(QuestionStatus::NEEDS_REVISION)];
+        a.totalXP            = static_cast<int>(xpSum);
+        a.totalRevisions     = static_cast<int>(revSum);
+        a.averageEaseFactor  = efCount > 0 ? efSum / efCount : 2.5;
+
+        vector<int> topicCount(symbols().size(), 0);
+        for (Symbol subj : table.subjectColumn()) topicCount[subj.id]++;
+        appendTopicCounts(topicCount, a.topicDistribution);
+        for (int d = 0; d < 3; ++d)
+            if (diffCount[d] > 0)
+                a.difficultyDistribution.emplace_back(
+                    difficultyToString(static_cast<Difficulty>(d)), diffCount[d]);
+
+        sort(a.topicDistribution.begin(), a.topicDistribution.end(),
+             [](const pair<string,int>& x, const pair<string,int>& y) {
+                 return x.second > y.second;
+             });
+        sort(a.difficultyDistribution.begin(), a.difficultyDistribution.end(),
+             [](const pair<string,int>& x, const pair<string,int>& y) {
+                 return x.second > y.second;
+             });
+
+        return a;
+    }
+
     // ── Per-Topic Statistics ──
 
     static vector<TopicStats> getTopicStats(const vector<Question>& questions) {
-        unordered_map<string, TopicStats> map;
+        vector<TopicStats> bySymbol(symbols().size());   // indexed by Symbol::id
 
         for (const auto& q : questions) {
-            auto& ts = map[q.subject];
-            ts.topic = q.subject;
+            auto& ts = bySymbol[q.subject.id];
             ts.total++;
             ts.totalXP += q.xpEarned;
 
@@ -125,8 +179,10 @@ public:
         }
 
         vector<TopicStats> result;
-        for (auto& kv : map) {
-            auto& ts = kv.second;
+        for (uint32_t id = 0; id < bySymbol.size(); ++id) {
+            auto& ts = bySymbol[id];
+            if (ts.total == 0) continue;
+            ts.topic = Symbol::fromId(id).str();
             int revised = ts.solved;  // approximate
             if (revised > 0)
                 ts.avgEaseFactor /= revised;
@@ -165,6 +221,31 @@ public:
         return db;
     }
 
+    static DifficultyBreakdown getDifficultyBreakdown(const QuestionTable& table) {
+        // counts[difficulty][status]
+        int counts[3][4] = {};
+        const uint8_t* diff = table.difficultyColumn().data();
+        const uint8_t* st   = table.statusColumn().data();
+        for (QuestionTable::RowId i = 0, n = table.size(); i < n; ++i)
+            counts[diff[i]][st[i]]++;
+
+        auto solvedOf = [&](Difficulty d) {
+            int k = static_cast<int>(d);
+            return counts[k][static_cast<int>(QuestionStatus::SOLVED)]
+                 + counts[k][static_cast<int>(QuestionStatus::MASTERED)];
+        };
+        auto totalOf = [&](Difficulty d) {
+            int k = static_cast<int>(d);
+            return counts[k][0] + counts[k][1] + counts[k][2] + counts[k][3];
+        };
+
+        DifficultyBreakdown db;
+        db.easy   = totalOf(Difficulty::EASY);   db.easySolved   = solvedOf(Difficulty::EASY);
+        db.medium = totalOf(Difficulty::MEDIUM); db.mediumSolved = solvedOf(Difficulty::MEDIUM);
+        db.hard   = totalOf(Difficulty::HARD);   db.hardSolved   = solvedOf(Difficulty::HARD);
+        return db;
+    }
+
     // ── Weakest / Strongest Topics ──
 
     static vector<string> getWeakestTopics(const vector<Question>& questions, int topN = 3) {
@@ -255,6 +336,13 @@ public:
              << "║ 💡 " << getStudySuggestion(questions) << "\n"
              << "╚══════════════════════════════════════════╝\n";
     }
+
+private:
+    static void appendTopicCounts(const vector<int>& counts, vector<pair<string, int>>& out) {
+        for (uint32_t id = 0; id < counts.size(); ++id)
+            if (counts[id] > 0)
+                out.emplace_back(Symbol::fromId(id).str(), counts[id]);
+    }
 };
 
 } // namespace dsa
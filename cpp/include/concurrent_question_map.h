@@ -0,0 +1,174 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Concurrent Sharded Question Map
+
+   N independent QuestionHashMap shards, each behind its own
+   shared_mutex and padded to its own cache lines. A key's shard comes
+   from the top bits of a separately seeded wyhash, independent of the
+   hash that picks a bucket inside each inner map.
+
+   Reads  : shared lock on one shard — readers of a shard run together
+   Writes : exclusive lock on one shard — other shards are unaffected
+   Size   : per-shard atomic counters, no locks
+
+   Each operation is linearizable because it locks exactly one shard.
+   forEach() / getAllQuestions() lock one shard at a time, so they see
+   every shard at a consistent point but not the whole map at once.
+
+   Time:  O(1) average per op        Space: O(n + shards × m)
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef CONCURRENT_QUESTION_MAP_H
+#define CONCURRENT_QUESTION_MAP_H
+
+#include "question_hashmap.h"
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+using namespace std;
+
+namespace dsa {
+
+class ConcurrentQuestionMap {
+public:
+    static constexpr size_t CACHE_LINE     = 64;
+    static constexpr size_t DEFAULT_SHARDS = 64;
+
+private:
+    struct alignas(CACHE_LINE) Shard {
+        mutable shared_mutex mu;
+        QuestionHashMap      map;
+        atomic<int64_t>      count{0};
+    };
+
+    unique_ptr<Shard[]> shards_;
+    size_t              shardCount_;
+    int                 shardShift_;      // 64 − log2(shardCount_)
+
+    static constexpr uint64_t SHARD_SEED = 0x9e3779b97f4a7c15ULL;
+
+    Shard& shardFor(string_view key) const {
+        uint64_t h = WyHash(SHARD_SEED)(key);
+        size_t i = shardShift_ >= 64 ? 0 : static_cast<size_t>(h >> shardShift_);
+        return shards_[i];
+    }
+
+public:
+    // shard count is rounded up to a power of two
+    explicit ConcurrentQuestionMap(size_t shards = DEFAULT_SHARDS) {
+        if (shards == 0) throw invalid_argument("ConcurrentQuestionMap — need at least one shard!");
+        size_t n = 1;
+        int bits = 0;
+        while (n < shards) { n <<= 1; ++bits; }
+        shards_.reset(new Shard[n]);
+        shardCount_ = n;
+        shardShift_ = 64 - bits;
+    }
+
+    ConcurrentQuestionMap(const ConcurrentQuestionMap&)            = delete;
+    ConcurrentQuestionMap& operator=(const ConcurrentQuestionMap&) = delete;
+
+    // ── Insert / Update ──
+    void put(const string& key, Question val) {
+        Shard& s = shardFor(key);
+        unique_lock<shared_mutex> lk(s.mu);
+        int before = s.map.size();
+        s.map.put(key, move(val));
+        if (s.map.size() != before) s.count.fetch_add(1, memory_order_relaxed);
+    }
+
+    // inserts only if the key is new; returns whether it did
+    bool putIfAbsent(const string& key, Question val) {
+        Shard& s = shardFor(key);
+        unique_lock<shared_mutex> lk(s.mu);
+        if (s.map.contains(key)) return false;
+        s.map.put(key, move(val));
+        s.count.fetch_add(1, memory_order_relaxed);
+        return true;
+    }
+
+    // ── Read (copies — the entry may change once the lock is dropped) ──
+    pair<bool, Question> get(string_view key) const {
+        Shard& s = shardFor(key);
+        shared_lock<shared_mutex> lk(s.mu);
+        return s.map.get(key);
+    }
+
+    bool contains(string_view key) const {
+        Shard& s = shardFor(key);
+        shared_lock<shared_mutex> lk(s.mu);
+        return s.map.contains(key);
+    }
+
+    // ── Zero-copy access under the shard lock — keep fn short ──
+    template <typename Fn>
+    bool visit(string_view key, Fn&& fn) const {
+        Shard& s = shardFor(key);
+        shared_lock<shared_mutex> lk(s.mu);
+        const Question* q = s.map.find(key);
+        if (q) fn(*q);
+        return q != nullptr;
+    }
+
+    // read-modify-write in place, atomic with respect to other ops on the key
+    template <typename Fn>
+    bool update(string_view key, Fn&& fn) {
+        Shard& s = shardFor(key);
+        unique_lock<shared_mutex> lk(s.mu);
+        return s.map.update(key, forward<Fn>(fn));
+    }
+
+    // ── Delete ──
+    bool remove(string_view key) {
+        Shard& s = shardFor(key);
+        unique_lock<shared_mutex> lk(s.mu);
+        if (!s.map.remove(key)) return false;
+        s.count.fetch_sub(1, memory_order_relaxed);
+        return true;
+    }
+
+    // ── Whole-map access — shard by shard ──
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        for (size_t i = 0; i < shardCount_; ++i) {
+            shared_lock<shared_mutex> lk(shards_[i].mu);
+            for (const auto& e : shards_[i].map) fn(e.first, e.second);
+        }
+    }
+
+    vector<Question> getAllQuestions() const {
+        vector<Question> out;
+        out.reserve(static_cast<size_t>(max<int64_t>(0, size())));
+        forEach([&](const string&, const Question& q) { out.push_back(q); });
+        return out;
+    }
+
+    // ── Stats ──
+    int64_t size() const {
+        int64_t n = 0;
+        for (size_t i = 0; i < shardCount_; ++i) n += shards_[i].count.load(memory_order_relaxed);
+        return n;
+    }
+
+    bool   empty()      const { return size() == 0; }
+    size_t shardCount() const { return shardCount_; }
+
+    void printStats() const {
+        int64_t minS = INT64_MAX, maxS = 0;
+        for (size_t i = 0; i < shardCount_; ++i) {
+            int64_t c = shards_[i].count.load(memory_order_relaxed);
+            minS = min(minS, c);
+            maxS = max(maxS, c);
+        }
+        cout << "\n╔══════════════════════════════════════════╗\n"
+             << "║     CONCURRENT QUESTION MAP (Sharded)    ║\n"
+             << "╠══════════════════════════════════════════╣\n"
+             << "║ Size: " << size() << " | Shards: " << shardCount_ << "\n"
+             << "║ Shard size min / max: " << minS << " / " << maxS << "\n"
+             << "╚══════════════════════════════════════════╝\n";
+    }
+};
+
+} // namespace dsa
+
+#endif // CONCURRENT_QUESTION_MAP_H
@@ -0,0 +1,220 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Concurrent Relaxed Priority Queue (MultiQueue)
+
+   Lanes  : C × threads independent RevisionHeaps, each behind its own
+            mutex and padded to its own cache lines. A question's lane
+            comes from a wyhash of its id, so re-pushing an id re-scores
+            it in place (RevisionHeap semantics) and remove /
+            updatePriority touch one lane.
+
+   Pop    : two-choice — sample two lanes, read their published top
+            scores (atomics, no lock), try_lock the better one. A busy
+            lane means sampling again; after TRY_LIMIT misses in a row
+            the popper waits for its pick instead of spinning.
+
+   Relaxed: pop() returns an item near the front, not always the
+            front. With m lanes, two-choice sampling keeps the expected
+            rank error O(m) and bounds it with high probability
+            (Alistarh et al., "The Power of Choice in Priority
+            Scheduling", PODC 2017). A single-threaded, single-lane
+            queue is exact.
+
+   Time:  push / remove → O(log n/m) under one lane lock
+          pop → O(log n/m) expected, lock-free sampling
+          top() → O(m) scan of the published scores
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef CONCURRENT_REVISION_QUEUE_H
+#define CONCURRENT_REVISION_QUEUE_H
+
+#include "revision_heap.h"
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+namespace dsa {
+
+class ConcurrentRevisionQueue {
+public:
+    static constexpr size_t CACHE_LINE     = 64;
+    static constexpr size_t LANES_PER_CORE = 2;      // the "C" in C × threads
+    static constexpr int    TRY_LIMIT      = 8;      // failed try_locks before a pop blocks
+
+private:
+    static constexpr double   EMPTY     = numeric_limits<double>::infinity();
+    static constexpr uint64_t LANE_SEED = 0x2545f4914f6cdd1dULL;
+
+    struct alignas(CACHE_LINE) Lane {
+        mutex          mu;
+        RevisionHeap   heap;
+        atomic<double> top{EMPTY};     // heap's best score, +inf when empty
+    };
+
+    unique_ptr<Lane[]> lanes_;
+    size_t             laneCount_;
+    atomic<int64_t>    size_{0};
+
+    Lane& laneFor(string_view id) const {
+        return lanes_[WyHash(LANE_SEED)(id) % laneCount_];
+    }
+
+    // caller holds l.mu
+    static void publish(Lane& l) {
+        l.top.store(l.heap.empty() ? EMPTY : l.heap.top().priorityScore, memory_order_release);
+    }
+
+    // per-thread xorshift — sampling must not share state between threads
+    static uint64_t nextRandom() {
+        thread_local uint64_t s = hash<thread::id>()(this_thread::get_id()) | 1;
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        return s;
+    }
+
+    // lane with the lowest published score, or laneCount_ if all look empty
+    size_t bestLane() const {
+        size_t best = laneCount_;
+        double bestScore = EMPTY;
+        for (size_t i = 0; i < laneCount_; ++i) {
+            double s = lanes_[i].top.load(memory_order_acquire);
+            if (s < bestScore) { bestScore = s; best = i; }
+        }
+        return best;
+    }
+
+public:
+    // lanes = 0 → LANES_PER_CORE × hardware threads
+    explicit ConcurrentRevisionQueue(size_t lanes = 0) {
+        if (lanes == 0) lanes = LANES_PER_CORE * max(1u, thread::hardware_concurrency());
+        lanes_.reset(new Lane[lanes]);
+        laneCount_ = lanes;
+    }
+
+    ConcurrentRevisionQueue(const ConcurrentRevisionQueue&)            = delete;
+    ConcurrentRevisionQueue& operator=(const ConcurrentRevisionQueue&) = delete;
+
+    // ── Insert / re-score ──
+    void push(const Question& q, EpochDay today) {
+        Lane& l = laneFor(q.id);
+        lock_guard<mutex> lk(l.mu);
+        int before = l.heap.size();
+        l.heap.push(q, today);
+        publish(l);
+        if (l.heap.size() != before) size_.fetch_add(1, memory_order_relaxed);
+    }
+
+    void push(const Question& q, const string& today) {
+        push(q, EpochDay::parse(today));
+    }
+
+    // ── Relaxed pop — false once the queue is observed empty ──
+    bool tryPop(HeapEntry& out) {
+        int misses = 0;
+        while (size_.load(memory_order_relaxed) > 0) {
+            size_t a = nextRandom() % laneCount_;
+            size_t b = nextRandom() % laneCount_;
+            double sa = lanes_[a].top.load(memory_order_acquire);
+            double sb = lanes_[b].top.load(memory_order_acquire);
+            size_t pick = sb < sa ? b : a;
+            if (min(sa, sb) == EMPTY) {
+                // both samples empty: few items left, look at every lane
+                pick = bestLane();
+                if (pick == laneCount_) { this_thread::yield(); continue; }
+            }
+
+            // after TRY_LIMIT busy lanes, wait for one — spinning only helps
+            // while lock holders are running, not when they are preempted
+            Lane& l = lanes_[pick];
+            unique_lock<mutex> lk(l.mu, defer_lock);
+            if (misses < TRY_LIMIT) {
+                if (!lk.try_lock()) { ++misses; continue; }
+            } else {
+                lk.lock();
+                misses = 0;
+            }
+            if (l.heap.empty()) continue;
+            out = l.heap.pop();
+            publish(l);
+            size_.fetch_sub(1, memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    HeapEntry pop() {
+        HeapEntry e;
+        if (!tryPop(e)) throw runtime_error("ConcurrentRevisionQueue::pop() — empty!");
+        return e;
+    }
+
+    // copy of the best entry across all lanes at the moment of the scan
+    bool tryTop(HeapEntry& out) const {
+        while (true) {
+            size_t i = bestLane();
+            if (i == laneCount_) return false;
+            Lane& l = lanes_[i];
+            lock_guard<mutex> lk(l.mu);
+            if (l.heap.empty()) continue;
+            HeapRef r = l.heap.top();
+            out = HeapEntry(r.question, r.priorityScore);
+            return true;
+        }
+    }
+
+    HeapEntry top() const {
+        HeapEntry e;
+        if (!tryTop(e)) throw runtime_error("ConcurrentRevisionQueue::top() — empty!");
+        return e;
+    }
+
+    // ── Indexed ops — one lane lock ──
+    bool contains(const string& qid) const {
+        Lane& l = laneFor(qid);
+        lock_guard<mutex> lk(l.mu);
+        return l.heap.contains(qid);
+    }
+
+    bool remove(const string& qid) {
+        Lane& l = laneFor(qid);
+        lock_guard<mutex> lk(l.mu);
+        if (!l.heap.remove(qid)) return false;
+        publish(l);
+        size_.fetch_sub(1, memory_order_relaxed);
+        return true;
+    }
+
+    void updatePriority(const string& qid, const Question& updated, EpochDay today) {
+        if (updated.id != qid) remove(qid);       // re-keyed: the new id may live in another lane
+        push(updated, today);
+    }
+
+    // ── Stats ──
+    int64_t size() const { return max<int64_t>(0, size_.load(memory_order_relaxed)); }
+    bool    empty() const { return size() == 0; }
+    size_t  laneCount() const { return laneCount_; }
+
+    void printStats() const {
+        int64_t minL = INT64_MAX, maxL = 0;
+        for (size_t i = 0; i < laneCount_; ++i) {
+            lock_guard<mutex> lk(lanes_[i].mu);
+            int64_t c = lanes_[i].heap.size();
+            minL = min(minL, c);
+            maxL = max(maxL, c);
+        }
+        cout << "\n╔══════════════════════════════════════════╗\n"
+             << "║     CONCURRENT REVISION QUEUE (Multi)    ║\n"
+             << "╠══════════════════════════════════════════╣\n"
+             << "║ Size: " << size() << " | Lanes: " << laneCount_ << "\n"
+             << "║ Lane size min / max: " << minL << " / " << maxL << "\n"
+             << "╚══════════════════════════════════════════╝\n";
+    }
+};
+
+} // namespace dsa
+
+#endif // CONCURRENT_REVISION_QUEUE_H
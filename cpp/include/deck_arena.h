@@ -0,0 +1,110 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Deck Arena (std::pmr region allocator)
+
+   One memory region per deck. Hash-map nodes, trie nodes and heap
+   storage built for a deck are carved out of large upstream blocks,
+   so loading a deck costs a handful of malloc calls instead of one
+   per node, related nodes sit next to each other, and destroying the
+   deck returns every block in one sweep.
+
+   Layers:  unsynchronized_pool_resource   — recycles freed nodes
+              └ monotonic_buffer_resource  — bump-pointer blocks
+                  └ CountingResource       — upstream malloc stats
+
+   Not thread-safe: one arena per deck / per loading thread.
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef DECK_ARENA_H
+#define DECK_ARENA_H
+
+#include <memory_resource>
+#include <iostream>
+#include <cstddef>
+
+using namespace std;
+
+namespace dsa {
+
+// ── Counts calls and bytes that reach the upstream resource ──
+
+class CountingResource : public pmr::memory_resource {
+private:
+    pmr::memory_resource* upstream_;
+    size_t allocations_;
+    size_t bytesInUse_;
+    size_t peakBytes_;
+
+    void* do_allocate(size_t bytes, size_t align) override {
+        void* p = upstream_->allocate(bytes, align);
+        allocations_++;
+        bytesInUse_ += bytes;
+        if (bytesInUse_ > peakBytes_) peakBytes_ = bytesInUse_;
+        return p;
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t align) override {
+        upstream_->deallocate(p, bytes, align);
+        bytesInUse_ -= bytes;
+    }
+
+    bool do_is_equal(const pmr::memory_resource& o) const noexcept override {
+        return this == &o;
+    }
+
+public:
+    explicit CountingResource(pmr::memory_resource* up = pmr::new_delete_resource())
+        : upstream_(up), allocations_(0), bytesInUse_(0), peakBytes_(0) {}
+
+    size_t allocations() const { return allocations_; }
+    size_t bytesInUse()  const { return bytesInUse_; }
+    size_t peakBytes()   const { return peakBytes_; }
+};
+
+// ── Per-deck region ──
+
+class DeckArena {
+public:
+    static constexpr size_t DEFAULT_BLOCK = 64 * 1024;
+
+private:
+    CountingResource                  counter_;
+    pmr::monotonic_buffer_resource    region_;
+    pmr::unsynchronized_pool_resource pool_;
+
+public:
+    explicit DeckArena(size_t initialBlock = DEFAULT_BLOCK,
+                       pmr::memory_resource* upstream = pmr::new_delete_resource())
+        : counter_(upstream),
+          region_(initialBlock, &counter_),
+          pool_(&region_) {}
+
+    DeckArena(const DeckArena&)            = delete;
+    DeckArena& operator=(const DeckArena&) = delete;
+
+    // hand this to QuestionHashMap / QuestionTrie / RevisionHeap
+    pmr::memory_resource* resource() { return &pool_; }
+
+    // drops every block at once; all containers using the arena
+    // must already be destroyed
+    void release() {
+        pool_.release();
+        region_.release();
+    }
+
+    size_t upstreamAllocations() const { return counter_.allocations(); }
+    size_t bytesReserved()       const { return counter_.bytesInUse(); }
+
+    void printStats() const {
+        cout << "\n╔══════════════════════════════════════════╗\n"
+             << "║        DECK ARENA (pmr region)           ║\n"
+             << "╠══════════════════════════════════════════╣\n"
+             << "║ Upstream allocations: " << counter_.allocations() << "\n"
+             << "║ Bytes reserved: " << counter_.bytesInUse() << "\n"
+             << "║ Peak bytes: " << counter_.peakBytes() << "\n"
+             << "╚══════════════════════════════════════════╝\n";
+    }
+};
+
+} // namespace dsa
+
+#endif // DECK_ARENA_H
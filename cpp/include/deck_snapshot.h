@@ -0,0 +1,559 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Memory-Mappable Binary Deck Snapshot
+
+   A versioned, position-independent file holding a question deck and
+   its lookup indexes. Opening a snapshot maps the file and validates
+   the header; records and indexes are then used in place, with no
+   per-record parsing or rebuilding.
+
+   File layout (little-endian, every section 8-byte aligned):
+
+     SnapshotHeader
+     records   SnapshotRecord[n]          fixed 80-byte rows
+     tags      uint32[]                   snapshot-local symbol ids
+     symbols   SnapshotString[s]          local symbol → string pool
+     strings   char[]                     ids, names, notes, symbols
+     hash      uint32[2^k]                open addressing, id → row+1
+     words     SnapshotWord[w]            lower-cased search words,
+                                          sorted, with running insert
+                                          counts (flattened trie)
+     due       uint32[d] + int32[d]       rows sorted by due day
+
+   Time:  open → O(symbols)  |  find(id) → O(1) avg
+          prefix / autocomplete → O(log w + K)  |  dueBy(day) → O(log d)
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef DECK_SNAPSHOT_H
+#define DECK_SNAPSHOT_H
+
+#include "dsa_core.h"
+#include <fstream>
+#include <stdexcept>
+#include <cstring>
+#include <cstdint>
+#include <unordered_map>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace dsa {
+
+// ── On-disk structures ──
+
+struct SnapshotSection {
+    uint64_t offset;
+    uint64_t count;
+};
+
+struct SnapshotHeader {
+    static constexpr char     MAGIC[8]   = {'D', 'S', 'A', 'D', 'E', 'C', 'K', '\0'};
+    static constexpr uint32_t VERSION    = 2;      // 2: SnapshotWord::hitsThrough
+    static constexpr uint32_t ENDIAN_TAG = 0x01020304;
+
+    char            magic[8];
+    uint32_t        version;
+    uint32_t        endianTag;
+    uint64_t        fileSize;
+    SnapshotSection records;
+    SnapshotSection tags;
+    SnapshotSection symbols;
+    SnapshotSection strings;
+    SnapshotSection hash;        // count is a power of two
+    SnapshotSection words;
+    SnapshotSection dueRows;
+    SnapshotSection dueDays;
+};
+
+struct SnapshotString {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct SnapshotRecord {
+    SnapshotString id;
+    SnapshotString name;
+    SnapshotString notes;
+    uint32_t subject;            // snapshot-local symbol
+    uint32_t platform;
+    uint32_t tagsOffset;         // into the tags section
+    uint32_t tagCount;
+    double   easeFactor;
+    int32_t  revisionCycle;
+    int32_t  streak;
+    int32_t  xpEarned;
+    int32_t  dateSolved;         // EpochDay::days
+    int32_t  nextRevisionDate;
+    int32_t  lastRevisionDate;
+    uint8_t  difficulty;
+    uint8_t  status;
+    uint8_t  pad[6];
+};
+
+struct SnapshotWord {
+    SnapshotString text;         // lower-cased
+    uint32_t       row;          // first question indexed under this word
+    uint32_t       hitsThrough;  // times this word and every earlier word were indexed
+};
+
+static_assert(sizeof(SnapshotRecord) == 80, "SnapshotRecord layout changed");
+static_assert(sizeof(SnapshotWord) == 16, "SnapshotWord layout changed");
+
+class DeckSnapshot {
+public:
+    // ── Lightweight view over a run of row numbers ──
+    struct RowRange {
+        const uint32_t* first;
+        const uint32_t* last;
+        const uint32_t* begin() const { return first; }
+        const uint32_t* end()   const { return last; }
+        size_t size()  const { return static_cast<size_t>(last - first); }
+        bool   empty() const { return first == last; }
+    };
+
+private:
+    const char*           base_;
+    size_t                size_;
+    const SnapshotHeader* header_;
+    vector<Symbol>        symbolMap_;   // snapshot-local → process Symbol
+#ifdef _WIN32
+    vector<uint64_t>      buffer_;      // fallback: whole file read into memory
+#endif
+
+    // FNV-1a — fixed here so files stay readable across builds
+    static uint64_t fnv1a(string_view s) {
+        uint64_t h = 1469598103934665603ULL;
+        for (unsigned char c : s) { h ^= c; h *= 1099511628211ULL; }
+        return h;
+    }
+
+    static string toLower(string_view s) {
+        string r(s);
+        transform(r.begin(), r.end(), r.begin(),
+                  [](unsigned char c) { return static_cast<char>(tolower(c)); });
+        return r;
+    }
+
+    template <typename T>
+    const T* section(const SnapshotSection& s) const {
+        return reinterpret_cast<const T*>(base_ + s.offset);
+    }
+
+    string_view text(const SnapshotString& s) const {
+        return string_view(section<char>(header_->strings) + s.offset, s.length);
+    }
+
+    void checkSection(const SnapshotSection& s, size_t elemSize, const char* what) const {
+        if (s.offset % 8 != 0 || s.offset > size_ ||
+            s.count > (size_ - s.offset) / (elemSize ? elemSize : 1))
+            throw runtime_error(string("DeckSnapshot::open() — bad section: ") + what);
+    }
+
+    void validateHeader() {
+        if (size_ < sizeof(SnapshotHeader))
+            throw runtime_error("DeckSnapshot::open() — file too small!");
+        header_ = reinterpret_cast<const SnapshotHeader*>(base_);
+        if (memcmp(header_->magic, SnapshotHeader::MAGIC, sizeof(header_->magic)) != 0)
+            throw runtime_error("DeckSnapshot::open() — not a deck snapshot!");
+        if (header_->version != SnapshotHeader::VERSION)
+            throw runtime_error("DeckSnapshot::open() — unsupported version!");
+        if (header_->endianTag != SnapshotHeader::ENDIAN_TAG)
+            throw runtime_error("DeckSnapshot::open() — byte order mismatch!");
+        if (header_->fileSize != size_)
+            throw runtime_error("DeckSnapshot::open() — truncated file!");
+
+        checkSection(header_->records, sizeof(SnapshotRecord), "records");
+        checkSection(header_->tags,    sizeof(uint32_t),       "tags");
+        checkSection(header_->symbols, sizeof(SnapshotString), "symbols");
+        checkSection(header_->strings, 1,                      "strings");
+        checkSection(header_->hash,    sizeof(uint32_t),       "hash");
+        checkSection(header_->words,   sizeof(SnapshotWord),   "words");
+        checkSection(header_->dueRows, sizeof(uint32_t),       "due rows");
+        checkSection(header_->dueDays, sizeof(int32_t),        "due days");
+        uint64_t hb = header_->hash.count;
+        if (hb == 0 || (hb & (hb - 1)) != 0 || header_->dueRows.count != header_->dueDays.count)
+            throw runtime_error("DeckSnapshot::open() — corrupt index!");
+
+        // the only per-open work: map the (few dozen) symbols
+        const SnapshotString* syms = section<SnapshotString>(header_->symbols);
+        symbolMap_.reserve(header_->symbols.count);
+        for (uint64_t i = 0; i < header_->symbols.count; ++i) {
+            if (static_cast<uint64_t>(syms[i].offset) + syms[i].length > header_->strings.count)
+                throw runtime_error("DeckSnapshot::open() — bad symbol!");
+            symbolMap_.push_back(Symbol::intern(text(syms[i])));
+        }
+    }
+
+    void unmap() {
+#ifndef _WIN32
+        if (base_) munmap(const_cast<char*>(base_), size_);
+#endif
+        base_   = nullptr;
+        size_   = 0;
+        header_ = nullptr;
+    }
+
+public:
+    DeckSnapshot() : base_(nullptr), size_(0), header_(nullptr) {}
+
+    explicit DeckSnapshot(const string& path) : DeckSnapshot() { open(path); }
+
+    ~DeckSnapshot() { unmap(); }
+
+    DeckSnapshot(const DeckSnapshot&)            = delete;
+    DeckSnapshot& operator=(const DeckSnapshot&) = delete;
+
+    // ── Open — map the file and validate; throws runtime_error ──
+    void open(const string& path) {
+        unmap();
+        symbolMap_.clear();
+#ifndef _WIN32
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw runtime_error("DeckSnapshot::open() — cannot open " + path);
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+            ::close(fd);
+            throw runtime_error("DeckSnapshot::open() — cannot stat " + path);
+        }
+        void* p = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) throw runtime_error("DeckSnapshot::open() — mmap failed!");
+        base_ = static_cast<const char*>(p);
+        size_ = static_cast<size_t>(st.st_size);
+#else
+        ifstream in(path, ios::binary | ios::ate);
+        if (!in) throw runtime_error("DeckSnapshot::open() — cannot open " + path);
+        size_ = static_cast<size_t>(in.tellg());
+        buffer_.assign((size_ + 7) / 8, 0);
+        in.seekg(0);
+        in.read(reinterpret_cast<char*>(buffer_.data()), static_cast<streamsize>(size_));
+        base_ = reinterpret_cast<const char*>(buffer_.data());
+#endif
+        try {
+            validateHeader();
+        } catch (...) {
+            unmap();
+            throw;
+        }
+    }
+
+    bool   isOpen() const { return base_ != nullptr; }
+    size_t size()   const { return header_ ? header_->records.count : 0; }
+
+    // ── Record access — zero-copy ──
+
+    const SnapshotRecord& record(uint32_t row) const {
+        return section<SnapshotRecord>(header_->records)[row];
+    }
+
+    string_view id(uint32_t row)    const { return text(record(row).id); }
+    string_view name(uint32_t row)  const { return text(record(row).name); }
+    string_view notes(uint32_t row) const { return text(record(row).notes); }
+    Symbol subject(uint32_t row)    const { return symbolMap_[record(row).subject]; }
+    Symbol platform(uint32_t row)   const { return symbolMap_[record(row).platform]; }
+
+    Question materialize(uint32_t row) const {
+        const SnapshotRecord& r = record(row);
+        Question q;
+        q.id               = string(text(r.id));
+        q.name             = string(text(r.name));
+        q.notes            = string(text(r.notes));
+        q.subject          = symbolMap_[r.subject];
+        q.platform         = symbolMap_[r.platform];
+        q.difficulty       = static_cast<Difficulty>(r.difficulty);
+        q.status           = static_cast<QuestionStatus>(r.status);
+        q.easeFactor       = r.easeFactor;
+        q.revisionCycle    = r.revisionCycle;
+        q.streak           = r.streak;
+        q.xpEarned         = r.xpEarned;
+        q.dateSolved       = EpochDay(r.dateSolved);
+        q.nextRevisionDate = EpochDay(r.nextRevisionDate);
+        q.lastRevisionDate = EpochDay(r.lastRevisionDate);
+        const uint32_t* tags = section<uint32_t>(header_->tags) + r.tagsOffset;
+        for (uint32_t i = 0; i < r.tagCount; ++i) q.tags.push_back(symbolMap_[tags[i]]);
+        return q;
+    }
+
+    // ── Hash index — id → row, -1 if absent ──
+    int64_t find(string_view qid) const {
+        const uint32_t* slots = section<uint32_t>(header_->hash);
+        uint64_t mask = header_->hash.count - 1;
+        uint64_t i = fnv1a(qid) & mask;
+        for (uint64_t probes = 0; probes <= mask; ++probes, i = (i + 1) & mask) {
+            uint32_t s = slots[i];
+            if (s == 0) return -1;
+            if (id(s - 1) == qid) return static_cast<int64_t>(s - 1);
+        }
+        return -1;      // full table — only a corrupt file has no empty slot
+    }
+
+    bool contains(string_view qid) const { return find(qid) >= 0; }
+
+    // ── Word index — same words and counts as QuestionTrie over the deck
+    //    (autocomplete order matches for ASCII words) ──
+
+    bool search(string_view word) const {
+        string low = toLower(word);
+        auto r = wordRange(low);
+        return r.first != r.second && text(r.first->text) == low;
+    }
+
+    // inserts, not distinct words — like QuestionTrie::countWithPrefix
+    int countWithPrefix(string_view prefix) const {
+        auto r = wordRange(toLower(prefix));
+        if (r.first == r.second) return 0;
+        const SnapshotWord* b = section<SnapshotWord>(header_->words);
+        uint32_t before = r.first == b ? 0 : (r.first - 1)->hitsThrough;
+        return static_cast<int>((r.second - 1)->hitsThrough - before);
+    }
+
+    vector<string> autocomplete(string_view prefix, int maxResults = 10) const {
+        auto r = wordRange(toLower(prefix));
+        vector<string> out;
+        for (auto w = r.first; w != r.second && static_cast<int>(out.size()) < maxResults; ++w)
+            out.emplace_back(text(w->text));
+        return out;
+    }
+
+    // row of the question a search word was indexed under, -1 if none
+    int64_t rowForWord(string_view word) const {
+        string low = toLower(word);
+        auto r = wordRange(low);
+        if (r.first == r.second || text(r.first->text) != low) return -1;
+        return static_cast<int64_t>(r.first->row);
+    }
+
+    // ── Due index — non-mastered rows with nextRevisionDate ≤ day ──
+    RowRange dueBy(EpochDay day) const {
+        const uint32_t* rows = section<uint32_t>(header_->dueRows);
+        const int32_t*  days = section<int32_t>(header_->dueDays);
+        size_t n = header_->dueDays.count;
+        size_t k = static_cast<size_t>(upper_bound(days, days + n, day.days) - days);
+        return RowRange{rows, rows + k};
+    }
+
+    // ── Full bounds check of every record (optional, O(n)) ──
+    bool verify() const {
+        uint64_t pool = header_->strings.count;
+        auto ok = [&](const SnapshotString& s) {
+            return static_cast<uint64_t>(s.offset) + s.length <= pool;
+        };
+        for (uint32_t i = 0; i < size(); ++i) {
+            const SnapshotRecord& r = record(i);
+            if (!ok(r.id) || !ok(r.name) || !ok(r.notes)) return false;
+            if (r.subject >= symbolMap_.size() || r.platform >= symbolMap_.size()) return false;
+            if (static_cast<uint64_t>(r.tagsOffset) + r.tagCount > header_->tags.count) return false;
+            const uint32_t* tags = section<uint32_t>(header_->tags) + r.tagsOffset;
+            for (uint32_t t = 0; t < r.tagCount; ++t)
+                if (tags[t] >= symbolMap_.size()) return false;
+            if (r.difficulty > 2 || r.status > 3) return false;
+        }
+        const uint32_t* slots = section<uint32_t>(header_->hash);
+        bool hasEmpty = false;
+        for (uint64_t i = 0; i < header_->hash.count; ++i) {
+            if (slots[i] > size()) return false;
+            hasEmpty |= slots[i] == 0;
+        }
+        if (!hasEmpty) return false;                   // probes would never stop
+        const SnapshotWord* words = section<SnapshotWord>(header_->words);
+        for (uint64_t i = 0; i < header_->words.count; ++i) {
+            if (!ok(words[i].text) || words[i].row >= size()) return false;
+            if (words[i].hitsThrough <= (i ? words[i - 1].hitsThrough : 0)) return false;
+        }
+        const uint32_t* due = section<uint32_t>(header_->dueRows);
+        for (uint64_t i = 0; i < header_->dueRows.count; ++i)
+            if (due[i] >= size()) return false;
+        return true;
+    }
+
+    // ── Write — builds every index and writes one file; throws on I/O error ──
+    static void write(const string& path, const vector<Question>& questions) {
+        if (questions.size() >= UINT32_MAX)
+            throw length_error("DeckSnapshot::write() — too many questions!");
+        const uint32_t n = static_cast<uint32_t>(questions.size());
+
+        // every offset and count in the file is uint32
+        string pool;
+        auto addText = [&](string_view s) {
+            if (s.size() > UINT32_MAX - pool.size())
+                throw length_error("DeckSnapshot::write() — string pool exceeds 4 GiB!");
+            SnapshotString ss{static_cast<uint32_t>(pool.size()), static_cast<uint32_t>(s.size())};
+            pool.append(s.data(), s.size());
+            return ss;
+        };
+
+        // snapshot-local symbol table
+        vector<SnapshotString>          symbolsOut;
+        unordered_map<uint32_t, uint32_t> localOf;   // Symbol::id → local
+        auto local = [&](Symbol s) {
+            auto it = localOf.find(s.id);
+            if (it != localOf.end()) return it->second;
+            uint32_t l = static_cast<uint32_t>(symbolsOut.size());
+            symbolsOut.push_back(addText(s.str()));
+            localOf.emplace(s.id, l);
+            return l;
+        };
+
+        vector<SnapshotRecord> records(n);
+        vector<uint32_t>       tags;
+        for (uint32_t i = 0; i < n; ++i) {
+            const Question& q = questions[i];
+            SnapshotRecord& r = records[i];
+            memset(&r, 0, sizeof(r));
+            r.id               = addText(q.id);
+            r.name             = addText(q.name);
+            r.notes            = addText(q.notes);
+            r.subject          = local(q.subject);
+            r.platform         = local(q.platform);
+            if (q.tags.size() > UINT32_MAX - tags.size())
+                throw length_error("DeckSnapshot::write() — too many tags!");
+            r.tagsOffset       = static_cast<uint32_t>(tags.size());
+            r.tagCount         = q.tags.size();
+            for (Symbol t : q.tags) tags.push_back(local(t));
+            r.easeFactor       = q.easeFactor;
+            r.revisionCycle    = q.revisionCycle;
+            r.streak           = q.streak;
+            r.xpEarned         = q.xpEarned;
+            r.dateSolved       = q.dateSolved.days;
+            r.nextRevisionDate = q.nextRevisionDate.days;
+            r.lastRevisionDate = q.lastRevisionDate.days;
+            r.difficulty       = static_cast<uint8_t>(q.difficulty);
+            r.status           = static_cast<uint8_t>(q.status);
+        }
+
+        // hash index — load factor ≤ 0.5, linear probing; first id wins
+        uint64_t buckets = 16;
+        while (buckets < 2ULL * n) buckets <<= 1;
+        vector<uint32_t> hash(buckets, 0);
+        for (uint32_t i = 0; i < n; ++i) {
+            string_view qid(questions[i].id);
+            for (uint64_t b = fnv1a(qid) & (buckets - 1);; b = (b + 1) & (buckets - 1)) {
+                if (hash[b] == 0) { hash[b] = i + 1; break; }
+                if (questions[hash[b] - 1].id == qid) break;
+            }
+        }
+
+        // word index — the trie's key set (name, subject, tags) in sorted order
+        vector<pair<string, uint32_t>> wordList;
+        for (uint32_t i = 0; i < n; ++i) {
+            const Question& q = questions[i];
+            wordList.emplace_back(toLower(q.name), i);
+            wordList.emplace_back(toLower(q.subject.str()), i);
+            for (Symbol t : q.tags) wordList.emplace_back(toLower(t.str()), i);
+        }
+        stable_sort(wordList.begin(), wordList.end(),
+                    [](const pair<string, uint32_t>& a, const pair<string, uint32_t>& b) {
+                        return a.first < b.first;
+                    });
+        if (wordList.size() >= UINT32_MAX)
+            throw length_error("DeckSnapshot::write() — too many search words!");
+        vector<SnapshotWord> words;
+        for (size_t i = 0; i < wordList.size(); ++i) {
+            if (i > 0 && wordList[i].first == wordList[i - 1].first) {
+                words.back().hitsThrough++;
+                continue;
+            }
+            SnapshotWord w;
+            w.text        = addText(wordList[i].first);
+            w.row         = wordList[i].second;
+            w.hitsThrough = static_cast<uint32_t>(i + 1);
+            words.push_back(w);
+        }
+
+        // due index — non-mastered questions with a date, by due day
+        vector<uint32_t> dueRows;
+        for (uint32_t i = 0; i < n; ++i)
+            if (questions[i].status != QuestionStatus::MASTERED &&
+                !questions[i].nextRevisionDate.empty())
+                dueRows.push_back(i);
+        stable_sort(dueRows.begin(), dueRows.end(), [&](uint32_t a, uint32_t b) {
+            return questions[a].nextRevisionDate < questions[b].nextRevisionDate;
+        });
+        vector<int32_t> dueDays;
+        dueDays.reserve(dueRows.size());
+        for (uint32_t r : dueRows) dueDays.push_back(questions[r].nextRevisionDate.days);
+
+        // ── lay out sections ──
+        SnapshotHeader h;
+        memset(&h, 0, sizeof(h));
+        memcpy(h.magic, SnapshotHeader::MAGIC, sizeof(h.magic));
+        h.version   = SnapshotHeader::VERSION;
+        h.endianTag = SnapshotHeader::ENDIAN_TAG;
+
+        uint64_t cursor = sizeof(SnapshotHeader);
+        auto place = [&](SnapshotSection& s, uint64_t count, size_t elemSize) {
+            cursor = (cursor + 7) & ~7ULL;
+            s.offset = cursor;
+            s.count  = count;
+            cursor  += count * elemSize;
+        };
+        place(h.records, records.size(),    sizeof(SnapshotRecord));
+        place(h.tags,    tags.size(),       sizeof(uint32_t));
+        place(h.symbols, symbolsOut.size(), sizeof(SnapshotString));
+        place(h.strings, pool.size(),       1);
+        place(h.hash,    hash.size(),       sizeof(uint32_t));
+        place(h.words,   words.size(),      sizeof(SnapshotWord));
+        place(h.dueRows, dueRows.size(),    sizeof(uint32_t));
+        place(h.dueDays, dueDays.size(),    sizeof(int32_t));
+        h.fileSize = cursor;
+
+        ofstream out(path, ios::binary | ios::trunc);
+        if (!out) throw runtime_error("DeckSnapshot::write() — cannot open " + path);
+
+        uint64_t written = 0;
+        auto emit = [&](const SnapshotSection& s, const void* data, size_t bytes) {
+            static const char zeros[8] = {};
+            if (s.offset > written)
+                out.write(zeros, static_cast<streamsize>(s.offset - written));
+            out.write(static_cast<const char*>(data), static_cast<streamsize>(bytes));
+            written = s.offset + bytes;
+        };
+        out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+        written = sizeof(h);
+        emit(h.records, records.data(),    records.size() * sizeof(SnapshotRecord));
+        emit(h.tags,    tags.data(),       tags.size() * sizeof(uint32_t));
+        emit(h.symbols, symbolsOut.data(), symbolsOut.size() * sizeof(SnapshotString));
+        emit(h.strings, pool.data(),       pool.size());
+        emit(h.hash,    hash.data(),       hash.size() * sizeof(uint32_t));
+        emit(h.words,   words.data(),      words.size() * sizeof(SnapshotWord));
+        emit(h.dueRows, dueRows.data(),    dueRows.size() * sizeof(uint32_t));
+        emit(h.dueDays, dueDays.data(),    dueDays.size() * sizeof(int32_t));
+
+        if (!out) throw runtime_error("DeckSnapshot::write() — write failed for " + path);
+    }
+
+    void printStats() const {
+        cout << "\n╔══════════════════════════════════════════╗\n"
+             << "║     DECK SNAPSHOT (memory-mapped)        ║\n"
+             << "╠══════════════════════════════════════════╣\n"
+             << "║ Questions: " << size() << " | Bytes: " << size_ << "\n"
+             << "║ Symbols: " << symbolMap_.size()
+             << " | Search words: " << (header_ ? header_->words.count : 0) << "\n"
+             << "║ Hash slots: " << (header_ ? header_->hash.count : 0)
+             << " | Due entries: " << (header_ ? header_->dueRows.count : 0) << "\n"
+             << "╚══════════════════════════════════════════╝\n";
+    }
+
+private:
+    // [first, last) of words starting with `prefix`
+    pair<const SnapshotWord*, const SnapshotWord*> wordRange(const string& prefix) const {
+        const SnapshotWord* b = section<SnapshotWord>(header_->words);
+        const SnapshotWord* e = b + header_->words.count;
+        const SnapshotWord* lo = lower_bound(b, e, prefix,
+            [&](const SnapshotWord& w, const string& p) { return text(w.text) < p; });
+        const SnapshotWord* hi = upper_bound(lo, e, prefix,
+            [&](const string& p, const SnapshotWord& w) {
+                return p < text(w.text).substr(0, p.size());
+            });
+        return {lo, hi};
+    }
+};
+
+} // namespace dsa
+
+#endif // DECK_SNAPSHOT_H
@@ -6,7 +6,10 @@
 #define DSA_CORE_H
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include <cstdint>
+#include <climits>
 #include <ctime>
 #include <iostream>
 #include <sstream>
@@ -14,6 +17,8 @@
 #include <functional>
 #include <iomanip>
 #include <cmath>
+#include "symbol_table.h"
+#include "question_id.h"
 
 using namespace std;
 
@@ -44,13 +49,129 @@ inline string statusToString(QuestionStatus s) {
     }
 }
 
+inline Difficulty difficultyFromString(string_view s) {
+    if (s == "Easy") return Difficulty::EASY;
+    if (s == "Hard") return Difficulty::HARD;
+    return Difficulty::MEDIUM;
+}
+
+inline QuestionStatus statusFromString(string_view s) {
+    if (s == "Solved")         return QuestionStatus::SOLVED;
+    if (s == "Needs Revision") return QuestionStatus::NEEDS_REVISION;
+    if (s == "Mastered")       return QuestionStatus::MASTERED;
+    return QuestionStatus::UNSOLVED;
+}
+
+// ── Epoch-Day Date Type ──
+//
+//   A civil date stored as days since 1970-01-01 in an int32.
+//   "YYYY-MM-DD" is parsed / formatted only at the edges, so date
+//   math and comparisons are plain integer operations.
+//   Civil ↔ day conversion: Howard Hinnant's days_from_civil.
+
+struct EpochDay {
+    static constexpr int32_t NONE = INT32_MIN;   // "no date" (empty string)
+
+    int32_t days;
+
+    constexpr EpochDay() : days(NONE) {}
+    constexpr explicit EpochDay(int32_t d) : days(d) {}
+
+    static constexpr EpochDay fromCivil(int y, int m, int d) {
+        y -= (m <= 2);
+        int era = (y >= 0 ? y : y - 399) / 400;
+        int yoe = y - era * 400;
+        int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+        int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return EpochDay(era * 146097 + doe - 719468);
+    }
+
+    void toCivil(int& y, int& m, int& d) const {
+        int z   = days + 719468;
+        int era = (z >= 0 ? z : z - 146096) / 146097;
+        int doe = z - era * 146097;
+        int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        int mp  = (5 * doy + 2) / 153;
+        d = doy - (153 * mp + 2) / 5 + 1;
+        m = mp < 10 ? mp + 3 : mp - 9;
+        y = yoe + era * 400 + (m <= 2);
+    }
+
+    // "YYYY-MM-DD" (trailing "THH:MM..." ignored) → day; NONE if malformed
+    static EpochDay parse(string_view s) {
+        if (s.size() < 10 || s[4] != '-' || s[7] != '-') return EpochDay();
+        int v[8];
+        static constexpr int pos[8] = {0, 1, 2, 3, 5, 6, 8, 9};
+        for (int i = 0; i < 8; ++i) {
+            unsigned c = static_cast<unsigned>(s[pos[i]]) - '0';
+            if (c > 9) return EpochDay();
+            v[i] = static_cast<int>(c);
+        }
+        int y = v[0] * 1000 + v[1] * 100 + v[2] * 10 + v[3];
+        int m = v[4] * 10 + v[5];
+        int d = v[6] * 10 + v[7];
+        if (m < 1 || m > 12 || d < 1 || d > daysInMonth(y, m)) return EpochDay();
+        return fromCivil(y, m, d);
+    }
+
+    static constexpr int daysInMonth(int y, int m) {
+        return m == 2 ? ((y % 4 == 0 && (y % 100 != 0 || y % 400 == 0)) ? 29 : 28)
+             : (m == 4 || m == 6 || m == 9 || m == 11) ? 30 : 31;
+    }
+
+    static EpochDay fromTm(const struct tm& t) {
+        return fromCivil(t.tm_year + 1900, t.tm_mon + 1, t.tm_mday);
+    }
+
+    static EpochDay today() {
+        time_t now = time(nullptr);
+        return fromTm(*localtime(&now));
+    }
+
+    string toString() const {
+        if (empty()) return string();
+        int y, m, d;
+        toCivil(y, m, d);
+        char buf[10] = {
+            static_cast<char>('0' + y / 1000 % 10), static_cast<char>('0' + y / 100 % 10),
+            static_cast<char>('0' + y / 10 % 10),   static_cast<char>('0' + y % 10), '-',
+            static_cast<char>('0' + m / 10),        static_cast<char>('0' + m % 10), '-',
+            static_cast<char>('0' + d / 10),        static_cast<char>('0' + d % 10)
+        };
+        return string(buf, sizeof(buf));
+    }
+
+    bool empty() const { return days == NONE; }
+
+    // NONE stays NONE — "no date" plus any number of days is still no date
+    EpochDay operator+(int n) const { return empty() ? EpochDay() : EpochDay(days + n); }
+    EpochDay operator-(int n) const { return empty() ? EpochDay() : EpochDay(days - n); }
+    // widened and clamped, so a NONE operand cannot overflow
+    int      operator-(EpochDay o) const {
+        int64_t diff = int64_t(days) - o.days;
+        return static_cast<int>(max<int64_t>(INT32_MIN, min<int64_t>(INT32_MAX, diff)));
+    }
+
+    bool operator==(EpochDay o) const { return days == o.days; }
+    bool operator!=(EpochDay o) const { return days != o.days; }
+    bool operator< (EpochDay o) const { return days <  o.days; }
+    bool operator<=(EpochDay o) const { return days <= o.days; }
+    bool operator> (EpochDay o) const { return days >  o.days; }
+    bool operator>=(EpochDay o) const { return days >= o.days; }
+};
+
+inline ostream& operator<<(ostream& os, EpochDay d) {
+    return os << d.toString();
+}
+
 // ── Core Structures ──
 
 struct Question {
     string id;
     string name;
-    string subject;
-    string platform;
+    Symbol subject;
+    Symbol platform;
     Difficulty difficulty;
     QuestionStatus status;
 
@@ -59,11 +180,11 @@ struct Question {
     int streak;
     int xpEarned;
 
-    string dateSolved;
-    string nextRevisionDate;
-    string lastRevisionDate;
+    EpochDay dateSolved;
+    EpochDay nextRevisionDate;
+    EpochDay lastRevisionDate;
 
-    vector<string> tags;
+    SymbolList tags;
     string notes;
 
     Question()
@@ -72,27 +193,47 @@ struct Question {
           easeFactor(2.5), revisionCycle(0),
           streak(0), xpEarned(0) {}
 
-    double getPriorityScore(const string& today) const {
-        if (nextRevisionDate.empty() || status == QuestionStatus::MASTERED)
+    // ── Priority: (daysOverdue × diffMult + easePen) × streakPen ──
+    static double priorityDiffMult(Difficulty d) {
+        return (d == Difficulty::HARD) ? 1.5 : (d == Difficulty::MEDIUM) ? 1.2 : 1.0;
+    }
+    static double priorityStreakPen(int streak) { return (streak < 3) ? 1.5 : 1.0; }
+
+    double getPriorityScore(EpochDay today) const {
+        if (nextRevisionDate.empty() || today.empty() || status == QuestionStatus::MASTERED)
             return -1.0;
 
-        int daysOverdue  = dateDiffDays(nextRevisionDate, today);
+        int daysOverdue  = today - nextRevisionDate;
         double priority  = static_cast<double>(daysOverdue);
-        double diffMult  = (difficulty == Difficulty::HARD)   ? 1.5
-                         : (difficulty == Difficulty::MEDIUM) ? 1.2 : 1.0;
+        double diffMult  = priorityDiffMult(difficulty);
         double easePen   = (2.5 - easeFactor) * 2.0;
-        double streakPen = (streak < 3) ? 1.5 : 1.0;
+        double streakPen = priorityStreakPen(streak);
 
         return (priority * diffMult + easePen) * streakPen;
     }
 
+    // The score is linear in the day: rate × today.days + offset. The rate
+    // (diffMult × streakPen) takes one of six values; the offset does not
+    // depend on today. Only meaningful for schedulable questions.
+    double priorityRate() const { return priorityDiffMult(difficulty) * priorityStreakPen(streak); }
+
+    double priorityOffset() const {
+        double easePen = (2.5 - easeFactor) * 2.0;
+        return (easePen - nextRevisionDate.days * priorityDiffMult(difficulty)) * priorityStreakPen(streak);
+    }
+
+    double getPriorityScore(const string& today) const {
+        return getPriorityScore(EpochDay::parse(today));
+    }
+
+    // 0 if either date is missing or malformed
+    static int dateDiffDays(EpochDay fromDate, EpochDay toDate) {
+        if (fromDate.empty() || toDate.empty()) return 0;
+        return toDate - fromDate;
+    }
+
     static int dateDiffDays(const string& fromDate, const string& toDate) {
-        struct tm from = {}, to = {};
-        istringstream issF(fromDate), issT(toDate);
-        issF >> get_time(&from, "%Y-%m-%d");
-        issT >> get_time(&to,   "%Y-%m-%d");
-        time_t tF = mktime(&from), tT = mktime(&to);
-        return static_cast<int>(difftime(tT, tF) / 86400);
+        return dateDiffDays(EpochDay::parse(fromDate), EpochDay::parse(toDate));
     }
 
     void print() const {
@@ -103,7 +244,7 @@ struct Question {
              << "│ Status: " << statusToString(status)
              << " | Cycle: " << revisionCycle
              << " | EF: " << easeFactor << "\n"
-             << "│ Next Rev: " << (nextRevisionDate.empty() ? "N/A" : nextRevisionDate) << "\n"
+             << "│ Next Rev: " << (nextRevisionDate.empty() ? "N/A" : nextRevisionDate.toString()) << "\n"
              << "│ XP: " << xpEarned << " | Streak: " << streak << "\n"
              << "└─────────────────────────────────────────\n";
     }
@@ -153,31 +294,20 @@ struct Analytics {
 // ── Utilities ──
 
 inline string todayStr() {
-    time_t now = time(nullptr);
-    struct tm* t = localtime(&now);
-    char buf[11];
-    strftime(buf, sizeof(buf), "%Y-%m-%d", t);
-    return string(buf);
+    return EpochDay::today().toString();
 }
 
+// thread-safe; see question_id.h for the id layout
 inline string generateId() {
-    static int counter = 0;
-    time_t now = time(nullptr);
-    ostringstream oss;
-    oss << hex << now << "-" << ++counter;
-    return oss.str();
+    return QuestionId::next().toString();
+}
+
+inline EpochDay addDaysToDate(EpochDay date, int days) {
+    return date.empty() ? date : date + days;
 }
 
 inline string addDaysToDate(const string& dateStr, int days) {
-    struct tm t = {};
-    istringstream iss(dateStr);
-    iss >> get_time(&t, "%Y-%m-%d");
-    time_t base = mktime(&t);
-    base += days * 86400;
-    struct tm* r = localtime(&base);
-    char buf[11];
-    strftime(buf, sizeof(buf), "%Y-%m-%d", r);
-    return string(buf);
+    return addDaysToDate(EpochDay::parse(dateStr), days).toString();
 }
 
 } // namespace dsa
@@ -0,0 +1,437 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Open-Addressing Question Map (Swiss-table layout)
+
+   Same put / get / contains / remove / filter API as QuestionHashMap,
+   but no per-entry nodes: a small open-addressed index points into one
+   dense array of entries.
+
+   Layout : ctrl_[i]    — one control byte per slot
+                          EMPTY (0x80) | DELETED (0xFE) | 0..127 = 7 hash bits
+            index_[i]   — position of the slot's entry in entries_
+            entries_    — pair<string, Question>, packed (removal moves the
+                          last entry into the hole), hashes_ alongside
+   Probe  : slots are grouped 16 at a time; a lookup compares the 7-bit
+            tag against a whole group with one SSE2 compare (scalar
+            fallback elsewhere), then checks keys only for tag hits.
+            Groups are visited in triangular order (1, 2, 3, … apart),
+            which reaches every group of a power-of-two table.
+   Hash   : FNV-1a 64 + splitmix64 finalizer (group index from the
+            high bits, tag from the low 7)
+
+   Growing rebuilds only ctrl_/index_ from the stored hashes; entries
+   are never rehashed or moved for it. Entry addresses are not stable
+   across inserts/removes (unlike the chained map).
+
+   Time:  Insert / Get / Delete → O(1) average, ~1 group per probe
+   Space: n entries + 5 bytes per slot (slots ≥ n / 0.875)
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef FLAT_QUESTION_MAP_H
+#define FLAT_QUESTION_MAP_H
+
+#include "dsa_core.h"
+#include "metrics.h"
+#include "range_view.h"
+#include <cstring>
+#include <memory_resource>
+#include <utility>
+
+// -DDSA_FLAT_MAP_SSE2=0 forces the portable scalar group scan
+#ifndef DSA_FLAT_MAP_SSE2
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DSA_FLAT_MAP_SSE2 1
+#else
+#define DSA_FLAT_MAP_SSE2 0
+#endif
+#endif
+
+#if DSA_FLAT_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+namespace dsa {
+
+class FlatQuestionMap {
+private:
+    using Entry = pair<string, Question>;
+
+    static constexpr int8_t EMPTY   = static_cast<int8_t>(0x80);
+    static constexpr int8_t DELETED = static_cast<int8_t>(0xFE);
+    static constexpr size_t GROUP   = 16;
+    static constexpr size_t INIT_CAP = 16;
+
+    // ── One 16-slot group of control bytes ──
+    struct Group {
+        const int8_t* ctrl;
+
+        // bit i set ⇔ ctrl[i] == b
+        uint32_t match(int8_t b) const {
+#if DSA_FLAT_MAP_SSE2
+            __m128i g = _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl));
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8(b))));
+#else
+            uint32_t m = 0;
+            for (size_t i = 0; i < GROUP; ++i)
+                if (ctrl[i] == b) m |= 1u << i;
+            return m;
+#endif
+        }
+
+        uint32_t matchEmpty() const { return match(EMPTY); }
+
+        // EMPTY or DELETED — both have the sign bit set
+        uint32_t matchFree() const {
+#if DSA_FLAT_MAP_SSE2
+            __m128i g = _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl));
+            return static_cast<uint32_t>(_mm_movemask_epi8(g));
+#else
+            uint32_t m = 0;
+            for (size_t i = 0; i < GROUP; ++i)
+                if (ctrl[i] < 0) m |= 1u << i;
+            return m;
+#endif
+        }
+    };
+
+    static int lowestBit(uint32_t m) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctz(m);
+#else
+        int i = 0;
+        while (!(m & 1u)) { m >>= 1; ++i; }
+        return i;
+#endif
+    }
+
+    pmr::memory_resource* mr_;
+    int8_t*               ctrl_;       // capacity_ bytes, 16-byte aligned
+    pmr::vector<uint32_t> index_;      // slot → entry position
+    pmr::vector<Entry>    entries_;
+    pmr::vector<uint64_t> hashes_;     // hash of entries_[i].first
+    size_t                capacity_;   // slots: power of two, multiple of GROUP
+    size_t                tombstones_;
+
+    // FNV-1a 64 + splitmix64 finalizer
+    static uint64_t hashKey(string_view key) {
+        uint64_t h = 1469598103934665603ULL;
+        for (unsigned char c : key) { h ^= c; h *= 1099511628211ULL; }
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+        return h ^ (h >> 31);
+    }
+
+    static int8_t tagOf(uint64_t h) { return static_cast<int8_t>(h & 0x7F); }
+    size_t groupMask() const { return capacity_ / GROUP - 1; }
+    size_t homeGroup(uint64_t h) const { return static_cast<size_t>(h >> 7) & groupMask(); }
+
+    // max occupied + deleted slots before a rebuild — 7/8
+    size_t growthLimit() const { return capacity_ - capacity_ / 8; }
+
+    void allocateIndex(size_t cap) {
+        capacity_ = cap;
+        ctrl_ = static_cast<int8_t*>(mr_->allocate(cap, GROUP));
+        memset(ctrl_, static_cast<unsigned char>(EMPTY), cap);
+        index_.assign(cap, 0);
+        tombstones_ = 0;
+    }
+
+    void freeIndex() {
+        if (ctrl_) mr_->deallocate(ctrl_, capacity_, GROUP);
+        ctrl_ = nullptr;
+    }
+
+    // slot holding `key`, or capacity_ if absent; `groups` = groups probed
+    size_t findSlot(string_view key, uint64_t h, int& groups) const {
+        groups = 0;
+        if (!ctrl_) return capacity_;                   // moved-from: no index yet
+        int8_t tag = tagOf(h);
+        size_t g = homeGroup(h);
+        for (size_t step = 1;; ++step) {
+            ++groups;
+            Group grp{ctrl_ + g * GROUP};
+            for (uint32_t m = grp.match(tag); m; m &= m - 1) {
+                size_t i = g * GROUP + static_cast<size_t>(lowestBit(m));
+                if (entries_[index_[i]].first == key) return i;
+            }
+            if (grp.matchEmpty()) return capacity_;
+            if (step > groupMask()) return capacity_;     // every group visited
+            g = (g + step) & groupMask();
+        }
+    }
+
+    size_t findSlot(string_view key) const { return findSlot(key, hashKey(key)); }
+
+    size_t findSlot(string_view key, uint64_t h) const {
+        int groups;
+        size_t i = findSlot(key, h, groups);
+        DSA_METRIC_ADD(HASHMAP_PROBES, groups);
+        DSA_METRIC_RECORD(HASHMAP_PROBES_PER_LOOKUP, groups);
+        return i;
+    }
+
+    // slot whose index_ entry is `pos` (pos must be present)
+    size_t slotOf(uint32_t pos) const {
+        uint64_t h = hashes_[pos];
+        int8_t tag = tagOf(h);
+        size_t g = homeGroup(h);
+        for (size_t step = 1;; ++step) {
+            for (uint32_t m = Group{ctrl_ + g * GROUP}.match(tag); m; m &= m - 1) {
+                size_t i = g * GROUP + static_cast<size_t>(lowestBit(m));
+                if (index_[i] == pos) return i;
+            }
+            g = (g + step) & groupMask();
+        }
+    }
+
+    // first EMPTY/DELETED slot on the probe path of h
+    size_t findFree(uint64_t h) const {
+        size_t g = homeGroup(h);
+        for (size_t step = 1;; ++step) {
+            uint32_t m = Group{ctrl_ + g * GROUP}.matchFree();
+            if (m) return g * GROUP + static_cast<size_t>(lowestBit(m));
+            g = (g + step) & groupMask();
+        }
+    }
+
+    // rebuild ctrl_/index_ at newCap from the stored hashes
+    void rebuildIndex(size_t newCap) {
+        DSA_METRIC_ADD(HASHMAP_REHASH, 1);
+        freeIndex();
+        allocateIndex(newCap);
+        for (uint32_t pos = 0; pos < entries_.size(); ++pos) {
+            size_t j = findFree(hashes_[pos]);
+            ctrl_[j]  = tagOf(hashes_[pos]);
+            index_[j] = pos;
+        }
+    }
+
+    // make room for one more insert
+    void reserveOne() {
+        if (!ctrl_) { allocateIndex(INIT_CAP); return; }
+        if (entries_.size() + tombstones_ + 1 <= growthLimit()) return;
+        // mostly tombstones → clean at the same size, otherwise double
+        rebuildIndex(entries_.size() + 1 <= growthLimit() / 2 ? capacity_ : capacity_ * 2);
+    }
+
+    // key must be absent
+    Entry& insertNew(const string& key, uint64_t h, Question&& val) {
+        reserveOne();
+        size_t i = findFree(h);
+        if (ctrl_[i] == DELETED) tombstones_--;
+        ctrl_[i]  = tagOf(h);
+        index_[i] = static_cast<uint32_t>(entries_.size());
+        entries_.emplace_back(key, move(val));
+        hashes_.push_back(h);
+        return entries_.back();
+    }
+
+    static size_t roundCapacity(size_t n) {
+        size_t cap = INIT_CAP;
+        while (cap - cap / 8 < n) cap *= 2;
+        return cap;
+    }
+
+public:
+    explicit FlatQuestionMap(pmr::memory_resource* mr = pmr::get_default_resource())
+        : mr_(mr), ctrl_(nullptr), index_(mr), entries_(mr), hashes_(mr),
+          capacity_(0), tombstones_(0) {
+        allocateIndex(INIT_CAP);
+    }
+
+    explicit FlatQuestionMap(int cap, pmr::memory_resource* mr = pmr::get_default_resource())
+        : mr_(mr), ctrl_(nullptr), index_(mr), entries_(mr), hashes_(mr),
+          capacity_(0), tombstones_(0) {
+        allocateIndex(roundCapacity(static_cast<size_t>(max(cap, 1))));
+        entries_.reserve(static_cast<size_t>(max(cap, 0)));
+        hashes_.reserve(static_cast<size_t>(max(cap, 0)));
+    }
+
+    ~FlatQuestionMap() { freeIndex(); }
+
+    FlatQuestionMap(const FlatQuestionMap&)            = delete;
+    FlatQuestionMap& operator=(const FlatQuestionMap&) = delete;
+
+    // leaves o empty but usable — its index is re-allocated by the next insert
+    FlatQuestionMap(FlatQuestionMap&& o) noexcept
+        : mr_(o.mr_), ctrl_(o.ctrl_), index_(move(o.index_)), entries_(move(o.entries_)),
+          hashes_(move(o.hashes_)), capacity_(o.capacity_), tombstones_(o.tombstones_) {
+        o.ctrl_ = nullptr;
+        o.capacity_ = o.tombstones_ = 0;
+    }
+
+    pmr::memory_resource* resource() const { return mr_; }
+
+    // ── Insert / Update — O(1) avg ──
+    void put(const string& key, Question val) {
+        DSA_METRIC_ADD(HASHMAP_PUT, 1);
+        DSA_METRIC_TIMER(HASHMAP_PUT_NS);
+        uint64_t h = hashKey(key);
+        int groups;
+        size_t i = findSlot(key, h, groups);
+        DSA_METRIC_ADD(HASHMAP_PROBES, groups);
+        if (i != capacity_) { entries_[index_[i]].second = move(val); return; }
+        insertNew(key, h, move(val));
+    }
+
+    // ── Get — O(1) avg ──
+    pair<bool, Question> get(string_view key) const {
+        DSA_METRIC_ADD(HASHMAP_GET, 1);
+        DSA_METRIC_TIMER(HASHMAP_GET_NS);
+        size_t i = findSlot(key);
+        if (i != capacity_) return {true, entries_[index_[i]].second};
+        return {false, Question()};
+    }
+
+    bool contains(string_view key) const {
+        DSA_METRIC_ADD(HASHMAP_GET, 1);
+        return findSlot(key) != capacity_;
+    }
+
+    // ── Zero-copy lookup — valid until the next insert or remove ──
+    const Question* find(string_view key) const { return find(key, hashKey(key)); }
+    Question*       find(string_view key)       { return find(key, hashKey(key)); }
+
+    static uint64_t hashOf(string_view key) { return hashKey(key); }
+
+    const Question* find(string_view key, uint64_t hash) const {
+        DSA_METRIC_ADD(HASHMAP_GET, 1);
+        size_t i = findSlot(key, hash);
+        return i != capacity_ ? &entries_[index_[i]].second : nullptr;
+    }
+
+    Question* find(string_view key, uint64_t hash) {
+        return const_cast<Question*>(static_cast<const FlatQuestionMap*>(this)->find(key, hash));
+    }
+
+    // ── Delete — O(1) avg; the last entry moves into the hole ──
+    bool remove(string_view key) {
+        DSA_METRIC_ADD(HASHMAP_REMOVE, 1);
+        DSA_METRIC_TIMER(HASHMAP_REMOVE_NS);
+        size_t i = findSlot(key);
+        if (i == capacity_) return false;
+
+        uint32_t pos  = index_[i];
+        uint32_t last = static_cast<uint32_t>(entries_.size() - 1);
+        if (pos != last) {
+            index_[slotOf(last)] = pos;
+            entries_[pos] = move(entries_[last]);
+            hashes_[pos]  = hashes_[last];
+        }
+        entries_.pop_back();
+        hashes_.pop_back();
+
+        // a probe stops at an EMPTY in this group, so nothing can lie past it
+        if (Group{ctrl_ + (i / GROUP) * GROUP}.matchEmpty()) {
+            ctrl_[i] = EMPTY;
+        } else {
+            ctrl_[i] = DELETED;
+            tombstones_++;
+        }
+        return true;
+    }
+
+    // ── Lazy views over the dense entry array ──
+    using const_iterator = pmr::vector<Entry>::const_iterator;
+
+    const_iterator begin() const { return entries_.begin(); }
+    const_iterator end()   const { return entries_.end(); }
+
+    QuestionFilterRange<const_iterator, AcceptAll> questions() const {
+        return {begin(), end(), AcceptAll()};
+    }
+
+    template <typename Pred>
+    QuestionFilterRange<const_iterator, Pred> where(Pred pred) const {
+        return {begin(), end(), move(pred)};
+    }
+
+    // ── Bulk Access (copying) ──
+    vector<Question> getAllQuestions() const {
+        vector<Question> out;
+        out.reserve(entries_.size());
+        for (const auto& e : entries_) out.push_back(e.second);
+        return out;
+    }
+
+    vector<Question> filter(function<bool(const Question&)> pred) const {
+        vector<Question> out;
+        for (const auto& e : entries_)
+            if (pred(e.second)) out.push_back(e.second);
+        return out;
+    }
+
+    vector<Question> getBySubject(const string& subj) const {
+        Symbol s = Symbol::find(subj);
+        if (!s.valid()) return {};
+        return filter([s](const Question& q) { return q.subject == s; });
+    }
+
+    vector<Question> getByDifficulty(Difficulty d) const {
+        return filter([d](const Question& q) { return q.difficulty == d; });
+    }
+
+    vector<Question> getByStatus(QuestionStatus s) const {
+        return filter([s](const Question& q) { return q.status == s; });
+    }
+
+    // ── Stats ──
+    int  size()       const { return static_cast<int>(entries_.size()); }
+    bool empty()      const { return entries_.empty(); }
+    int  capacity()   const { return static_cast<int>(capacity_); }
+    double loadFactor() const {
+        return capacity_ ? static_cast<double>(entries_.size()) / capacity_ : 0.0;
+    }
+
+    // entries whose slot is outside their home group
+    int collisionCount() const {
+        int c = 0;
+        for (size_t i = 0; i < capacity_; ++i)
+            if (ctrl_[i] >= 0 && i / GROUP != homeGroup(hashes_[index_[i]])) c++;
+        return c;
+    }
+
+    void printStats() const {
+        // re-probe every key to measure probe lengths (in groups)
+        long long totalGroups = 0;
+        int maxGroups = 0;
+        int hist[4] = {0, 0, 0, 0};    // 1, 2, 3, 4+ groups
+        int emptySlots = 0;
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (ctrl_[i] == EMPTY) emptySlots++;
+            if (ctrl_[i] < 0) continue;
+            int groups;
+            const Entry& e = entries_[index_[i]];
+            findSlot(e.first, hashes_[index_[i]], groups);
+            totalGroups += groups;
+            maxGroups = max(maxGroups, groups);
+            hist[min(groups, 4) - 1]++;
+        }
+        size_t n = entries_.size();
+        double avg = n ? static_cast<double>(totalGroups) / n : 0.0;
+        cout << "\n╔══════════════════════════════════════════╗\n"
+             << "║   FLAT QUESTION MAP (Swiss table" << (DSA_FLAT_MAP_SSE2 ? ", SSE2" : "") << ")\n"
+             << "╠══════════════════════════════════════════╣\n"
+             << "║ Size: " << n << " | Slots: " << capacity_ << "\n"
+             << "║ Load Factor: " << fixed << setprecision(3) << loadFactor() << "\n"
+             << "║ Empty Slots: " << emptySlots << " | Tombstones: " << tombstones_ << "\n"
+             << "║ Avg Probe Length: " << avg << " groups\n"
+             << "║ Max Probe Length: " << maxGroups << " groups\n"
+             << "║ Probes 1/2/3/4+: " << hist[0] << " / " << hist[1] << " / "
+             << hist[2] << " / " << hist[3] << "\n"
+             << "╚══════════════════════════════════════════╝\n";
+    }
+
+    Question& operator[](const string& key) {
+        uint64_t h = hashKey(key);
+        int groups;
+        size_t i = findSlot(key, h, groups);
+        if (i != capacity_) return entries_[index_[i]].second;
+        return insertNew(key, h, Question()).second;
+    }
+};
+
+} // namespace dsa
+
+#endif // FLAT_QUESTION_MAP_H
@@ -0,0 +1,487 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Streaming Importer for the Frontend JSON Export
+
+   Reads the document produced by js/store.js exportData():
+
+     { "questions": [...], "userStats": {...}, "activityLog": [...],
+       "settings": {...}, "dailyLog": { "YYYY-MM-DD": {...} },
+       "syllabus": [...], "exportDate": "...", "version": "2.0" }
+
+   Design : pull parser over a fixed-size refillable buffer (file or
+            pipe). Strings without escapes are returned as string_views
+            into the buffer; nothing is built for skipped values, and
+            no DOM is ever materialized. Each question is parsed, then
+            pushed into the hash map, trie and revision heap in the
+            same pass.
+
+   Memory: O(buffer + largest single token), independent of file size
+   Time:   O(bytes)
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef JSON_IMPORTER_H
+#define JSON_IMPORTER_H
+
+#include "dsa_core.h"
+#include "question_hashmap.h"
+#include "question_trie.h"
+#include "revision_heap.h"
+#include <cstdio>
+#include <cstring>
+#include <charconv>
+#include <stdexcept>
+#include <functional>
+
+using namespace std;
+
+namespace dsa {
+
+// ── Incremental JSON tokenizer ──
+
+class JsonStreamReader {
+public:
+    using Source = function<size_t(char*, size_t)>;   // returns 0 at end of input
+
+    static constexpr size_t DEFAULT_BUFFER = 256 * 1024;
+
+private:
+    Source       source_;
+    vector<char> buf_;
+    size_t       pos_;
+    size_t       end_;
+    size_t       consumed_;   // bytes dropped from the front of buf_
+    bool         eof_;
+    string       scratch_;    // decoded strings that contained escapes
+
+    // make at least `need` unread bytes available; false at end of input
+    bool fill(size_t need) {
+        while (end_ - pos_ < need) {
+            if (eof_) return false;
+            if (pos_ > 0) {
+                memmove(buf_.data(), buf_.data() + pos_, end_ - pos_);
+                consumed_ += pos_;
+                end_ -= pos_;
+                pos_ = 0;
+            }
+            if (end_ == buf_.size()) buf_.resize(buf_.size() * 2);   // oversized token
+            size_t got = source_(buf_.data() + end_, buf_.size() - end_);
+            if (got == 0) eof_ = true;
+            end_ += got;
+        }
+        return true;
+    }
+
+    static void appendUtf8(string& out, uint32_t cp) {
+        if (cp < 0x80) {
+            out += static_cast<char>(cp);
+        } else if (cp < 0x800) {
+            out += static_cast<char>(0xC0 | (cp >> 6));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            out += static_cast<char>(0xE0 | (cp >> 12));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (cp >> 18));
+            out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (cp & 0x3F));
+        }
+    }
+
+    uint32_t readHex4() {
+        if (!fill(4)) fail("truncated \\u escape");
+        uint32_t v = 0;
+        for (int i = 0; i < 4; ++i) {
+            char c = buf_[pos_++];
+            v <<= 4;
+            if (c >= '0' && c <= '9')      v |= static_cast<uint32_t>(c - '0');
+            else if (c >= 'a' && c <= 'f') v |= static_cast<uint32_t>(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') v |= static_cast<uint32_t>(c - 'A' + 10);
+            else fail("bad \\u escape");
+        }
+        return v;
+    }
+
+    // slow path: the string has escapes — decode into scratch_
+    string_view decodeEscaped(size_t start) {
+        scratch_.assign(buf_.data() + start, pos_ - start);
+        while (true) {
+            if (!fill(1)) fail("unterminated string");
+            char c = buf_[pos_++];
+            if (c == '"') return string_view(scratch_);
+            if (c != '\\') { scratch_ += c; continue; }
+            if (!fill(1)) fail("unterminated escape");
+            char e = buf_[pos_++];
+            switch (e) {
+                case '"':  scratch_ += '"';  break;
+                case '\\': scratch_ += '\\'; break;
+                case '/':  scratch_ += '/';  break;
+                case 'b':  scratch_ += '\b'; break;
+                case 'f':  scratch_ += '\f'; break;
+                case 'n':  scratch_ += '\n'; break;
+                case 'r':  scratch_ += '\r'; break;
+                case 't':  scratch_ += '\t'; break;
+                case 'u': {
+                    // a high surrogate pairs only with a following low one;
+                    // an unpaired half becomes U+FFFD and the next \u
+                    // escape is decoded on its own
+                    uint32_t cp = readHex4();
+                    while (cp >= 0xD800 && cp <= 0xDBFF && fill(2) &&
+                           buf_[pos_] == '\\' && buf_[pos_ + 1] == 'u') {
+                        pos_ += 2;
+                        uint32_t lo = readHex4();
+                        if (lo >= 0xDC00 && lo <= 0xDFFF) {
+                            cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                            break;
+                        }
+                        appendUtf8(scratch_, 0xFFFD);
+                        cp = lo;
+                    }
+                    if (cp >= 0xD800 && cp <= 0xDFFF) cp = 0xFFFD;
+                    appendUtf8(scratch_, cp);
+                    break;
+                }
+                default: fail("bad escape");
+            }
+        }
+    }
+
+public:
+    explicit JsonStreamReader(Source src, size_t bufferSize = DEFAULT_BUFFER)
+        : source_(move(src)), buf_(bufferSize < 64 ? 64 : bufferSize),
+          pos_(0), end_(0), consumed_(0), eof_(false) {}
+
+    [[noreturn]] void fail(const string& what) const {
+        throw runtime_error("JsonImporter: " + what + " at byte " +
+                            to_string(consumed_ + pos_));
+    }
+
+    size_t bytesRead() const { return consumed_ + end_; }
+
+    // next non-whitespace character without consuming it; 0 at end
+    char peek() {
+        while (true) {
+            while (pos_ < end_) {
+                char c = buf_[pos_];
+                if (c != ' ' && c != '\n' && c != '\r' && c != '\t') return c;
+                ++pos_;
+            }
+            if (!fill(1)) return 0;
+        }
+    }
+
+    void expect(char c) {
+        if (peek() != c) fail(string("expected '") + c + "'");
+        ++pos_;
+    }
+
+    // consume `c` if it is next
+    bool accept(char c) {
+        if (peek() != c) return false;
+        ++pos_;
+        return true;
+    }
+
+    // ── String — view valid until the next reader call ──
+    string_view readString() {
+        expect('"');
+        size_t start = pos_;
+        while (true) {
+            while (pos_ < end_) {
+                char c = buf_[pos_];
+                if (c == '"') {
+                    string_view v(buf_.data() + start, pos_ - start);
+                    ++pos_;
+                    return v;
+                }
+                if (c == '\\') return decodeEscaped(start);
+                ++pos_;
+            }
+            // token crosses the buffer end: refill keeps [start, pos_) intact
+            size_t off = pos_ - start;
+            pos_ = start;
+            if (!fill(off + 1)) fail("unterminated string");
+            start = pos_;
+            pos_  = start + off;
+        }
+    }
+
+    // ── Number ──
+    double readNumber() {
+        peek();
+        size_t len = 0;
+        while (true) {
+            while (pos_ + len < end_) {
+                char c = buf_[pos_ + len];
+                if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' ||
+                    c == 'e' || c == 'E') ++len;
+                else goto done;
+            }
+            if (!fill(len + 1)) break;
+        }
+    done:
+        if (len == 0) fail("expected number");
+        double v = 0;
+        auto r = from_chars(buf_.data() + pos_, buf_.data() + pos_ + len, v);
+        if (r.ec != errc()) fail("bad number");
+        pos_ += len;
+        return v;
+    }
+
+    bool readLiteral(const char* word) {
+        size_t n = strlen(word);
+        if (!fill(n) || memcmp(buf_.data() + pos_, word, n) != 0) return false;
+        pos_ += n;
+        return true;
+    }
+
+    bool acceptNull() { return peek() == 'n' && readLiteral("null"); }
+
+    bool readBool() {
+        if (peek() == 't' && readLiteral("true"))  return true;
+        if (peek() == 'f' && readLiteral("false")) return false;
+        fail("expected boolean");
+    }
+
+    // string, or null → empty
+    string_view readStringOrNull() {
+        if (acceptNull()) return string_view();
+        return readString();
+    }
+
+    double readNumberOr(double fallback) {
+        char c = peek();
+        if (c == '-' || (c >= '0' && c <= '9')) return readNumber();
+        skipValue();
+        return fallback;
+    }
+
+    // ── Skip any value without building it ──
+    void skipValue() {
+        int depth = 0;
+        do {
+            char c = peek();
+            switch (c) {
+                case '{': case '[': ++pos_; ++depth; break;
+                case '}': case ']': ++pos_; --depth; break;
+                case ',': case ':': ++pos_; break;
+                case '"': readString(); break;
+                case 't': if (!readLiteral("true"))  fail("bad literal"); break;
+                case 'f': if (!readLiteral("false")) fail("bad literal"); break;
+                case 'n': if (!readLiteral("null"))  fail("bad literal"); break;
+                case 0:   fail("unexpected end of input");
+                default:  readNumber(); break;
+            }
+        } while (depth > 0);
+    }
+
+    // ── Container iteration helpers ──
+
+    // call fn(key) for each member; fn must consume the value
+    template <typename Fn>
+    void forEachMember(Fn&& fn) {
+        expect('{');
+        if (accept('}')) return;
+        do {
+            string key(readString());   // small; value parsing may refill
+            expect(':');
+            fn(key);
+        } while (accept(','));
+        expect('}');
+    }
+
+    // call fn() for each element; fn must consume the element
+    template <typename Fn>
+    void forEachElement(Fn&& fn) {
+        expect('[');
+        if (accept(']')) return;
+        do { fn(); } while (accept(','));
+        expect(']');
+    }
+};
+
+// ── Import results ──
+
+struct ImportedUserStats {
+    int      totalXP;
+    int      level;
+    int      currentStreak;
+    int      longestStreak;
+    int      totalRevisions;
+    int      dailyGoal;
+    EpochDay lastActiveDate;
+
+    ImportedUserStats()
+        : totalXP(0), level(1), currentStreak(0), longestStreak(0),
+          totalRevisions(0), dailyGoal(5) {}
+};
+
+struct DailyLogEntry {
+    EpochDay date;
+    int      solved;
+    int      revised;
+    int      xpEarned;
+
+    DailyLogEntry() : solved(0), revised(0), xpEarned(0) {}
+};
+
+struct ImportResult {
+    int                   questionsImported;
+    int                   activityEntries;
+    ImportedUserStats     userStats;
+    vector<DailyLogEntry> dailyLog;
+    string                version;
+    string                exportDate;
+    size_t                bytesRead;
+
+    ImportResult() : questionsImported(0), activityEntries(0), bytesRead(0) {}
+};
+
+// where parsed questions go; any member may be null
+struct ImportTargets {
+    QuestionHashMap* map;
+    QuestionTrie*    trie;
+    RevisionHeap*    heap;             // must own its store — each question is a temporary
+    EpochDay         today;            // heap priorities are computed for this day
+    function<void(const Question&)> onQuestion;
+
+    ImportTargets() : map(nullptr), trie(nullptr), heap(nullptr), today(EpochDay::today()) {}
+};
+
+// ── Importer ──
+
+class JsonImporter {
+private:
+    JsonStreamReader in_;
+    ImportTargets    targets_;
+    ImportResult     result_;
+
+    static int toInt(double d) { return static_cast<int>(d); }
+
+    void readQuestion() {
+        Question q;
+        in_.forEachMember([&](const string& key) {
+            if      (key == "id")               q.id = string(in_.readStringOrNull());
+            else if (key == "name")             q.name = string(in_.readStringOrNull());
+            else if (key == "subject")          q.subject = Symbol::intern(in_.readStringOrNull());
+            else if (key == "platform")         q.platform = Symbol::intern(in_.readStringOrNull());
+            else if (key == "difficulty")       q.difficulty = difficultyFromString(in_.readStringOrNull());
+            else if (key == "status")           q.status = statusFromString(in_.readStringOrNull());
+            else if (key == "easeFactor")       q.easeFactor = in_.readNumberOr(2.5);
+            else if (key == "revisionCycle")    q.revisionCycle = toInt(in_.readNumberOr(0));
+            else if (key == "streak")           q.streak = toInt(in_.readNumberOr(0));
+            else if (key == "xpEarned")         q.xpEarned = toInt(in_.readNumberOr(0));
+            else if (key == "dateSolved")       q.dateSolved = EpochDay::parse(in_.readStringOrNull());
+            else if (key == "nextRevisionDate") q.nextRevisionDate = EpochDay::parse(in_.readStringOrNull());
+            else if (key == "lastRevisionDate") q.lastRevisionDate = EpochDay::parse(in_.readStringOrNull());
+            else if (key == "notes")            q.notes = string(in_.readStringOrNull());
+            else if (key == "tags") {
+                if (in_.acceptNull()) return;
+                in_.forEachElement([&] { q.tags.push_back(Symbol::intern(in_.readStringOrNull())); });
+            }
+            else in_.skipValue();
+        });
+
+        if (targets_.trie) targets_.trie->insertQuestion(q);
+        if (targets_.heap && q.status != QuestionStatus::MASTERED &&
+            !q.nextRevisionDate.empty() && q.getPriorityScore(targets_.today) >= 0)
+            targets_.heap->push(q, targets_.today);
+        if (targets_.onQuestion) targets_.onQuestion(q);
+        result_.questionsImported++;
+        if (targets_.map) {
+            string key = q.id;
+            targets_.map->put(key, move(q));
+        }
+    }
+
+    void readUserStats() {
+        ImportedUserStats& u = result_.userStats;
+        in_.forEachMember([&](const string& key) {
+            if      (key == "totalXP")        u.totalXP = toInt(in_.readNumberOr(0));
+            else if (key == "level")          u.level = toInt(in_.readNumberOr(1));
+            else if (key == "currentStreak")  u.currentStreak = toInt(in_.readNumberOr(0));
+            else if (key == "longestStreak")  u.longestStreak = toInt(in_.readNumberOr(0));
+            else if (key == "totalRevisions") u.totalRevisions = toInt(in_.readNumberOr(0));
+            else if (key == "dailyGoal")      u.dailyGoal = toInt(in_.readNumberOr(5));
+            else if (key == "lastActiveDate") u.lastActiveDate = EpochDay::parse(in_.readStringOrNull());
+            else in_.skipValue();
+        });
+    }
+
+    void readDailyLog() {
+        in_.forEachMember([&](const string& key) {
+            DailyLogEntry e;
+            e.date = EpochDay::parse(key);
+            in_.forEachMember([&](const string& field) {
+                if      (field == "solved")   e.solved = toInt(in_.readNumberOr(0));
+                else if (field == "revised")  e.revised = toInt(in_.readNumberOr(0));
+                else if (field == "xpEarned") e.xpEarned = toInt(in_.readNumberOr(0));
+                else in_.skipValue();
+            });
+            result_.dailyLog.push_back(e);
+        });
+    }
+
+public:
+    JsonImporter(JsonStreamReader::Source src, const ImportTargets& targets,
+                 size_t bufferSize = JsonStreamReader::DEFAULT_BUFFER)
+        : in_(move(src), bufferSize), targets_(targets) {
+        if (targets_.heap && targets_.heap->borrowsStore())
+            throw invalid_argument("JsonImporter: heap target borrows its store — pass an owning RevisionHeap");
+    }
+
+    ImportResult run() {
+        in_.forEachMember([&](const string& key) {
+            if (key == "questions") {
+                in_.forEachElement([&] { readQuestion(); });
+            } else if (key == "userStats") {
+                if (!in_.acceptNull()) readUserStats();
+            } else if (key == "activityLog") {
+                if (in_.acceptNull()) return;
+                in_.forEachElement([&] { in_.skipValue(); result_.activityEntries++; });
+            } else if (key == "dailyLog") {
+                if (!in_.acceptNull()) readDailyLog();
+            } else if (key == "version") {
+                result_.version = string(in_.readStringOrNull());
+            } else if (key == "exportDate") {
+                result_.exportDate = string(in_.readStringOrNull());
+            } else {
+                in_.skipValue();   // settings, syllabus, future keys
+            }
+        });
+        result_.bytesRead = in_.bytesRead();
+        return result_;
+    }
+
+    // ── Convenience entry points ──
+
+    static ImportResult importStream(FILE* f, const ImportTargets& targets) {
+        JsonImporter imp([f](char* dst, size_t n) { return fread(dst, 1, n, f); }, targets);
+        return imp.run();
+    }
+
+    static ImportResult importStream(istream& is, const ImportTargets& targets) {
+        JsonImporter imp([&is](char* dst, size_t n) {
+            is.read(dst, static_cast<streamsize>(n));
+            return static_cast<size_t>(is.gcount());
+        }, targets);
+        return imp.run();
+    }
+
+    static ImportResult importFile(const string& path, const ImportTargets& targets) {
+        FILE* f = fopen(path.c_str(), "rb");
+        if (!f) throw runtime_error("JsonImporter: cannot open " + path);
+        try {
+            ImportResult r = importStream(f, targets);
+            fclose(f);
+            return r;
+        } catch (...) {
+            fclose(f);
+            throw;
+        }
+    }
+};
+
+} // namespace dsa
+
+#endif // JSON_IMPORTER_H
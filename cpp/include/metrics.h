@@ -0,0 +1,273 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Hot-Path Metrics (counters + latency histograms)
+
+   Compiled in only with -DDSA_METRICS=1 (make METRICS=1). Without it
+   every DSA_METRIC_* hook expands to nothing and the engines build
+   exactly as before.
+
+   Counters   : relaxed atomics, one per event kind
+   Histograms : 64 log2 buckets — bucket b holds values in [2^(b-1), 2^b)
+                (bucket 0 holds 0), plus count / sum / max
+   Export     : printMetrics() box report, toJson() for scraping
+
+   Thread-safe; hooks never allocate or lock.
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#ifndef DSA_METRICS
+#define DSA_METRICS 0
+#endif
+
+using namespace std;
+
+namespace dsa {
+
+// ── Metric catalogue ──
+
+enum class MetricCounter {
+    HASHMAP_GET, HASHMAP_PUT, HASHMAP_REMOVE, HASHMAP_PROBES, HASHMAP_REHASH,
+    HEAP_PUSH, HEAP_POP, HEAP_SIFT_STEPS,
+    TRIE_INSERT, TRIE_AUTOCOMPLETE, TRIE_FUZZY, TRIE_NODES_VISITED,
+    SORT_CALLS, SORT_COMPARISONS, SORT_MOVES,
+    GRAPH_TRAVERSALS, GRAPH_NODES_EXPANDED, GRAPH_EDGES_SCANNED,
+    COUNT_
+};
+
+enum class MetricHistogram {
+    HASHMAP_PROBES_PER_LOOKUP, HASHMAP_CHAIN_LENGTH,
+    HASHMAP_GET_NS, HASHMAP_PUT_NS, HASHMAP_REMOVE_NS,
+    HEAP_SIFT_DEPTH, HEAP_PUSH_NS, HEAP_POP_NS,
+    TRIE_NODES_PER_QUERY, TRIE_AUTOCOMPLETE_NS, TRIE_FUZZY_NS,
+    SORT_NS,
+    GRAPH_NODES_PER_TRAVERSAL, GRAPH_TRAVERSAL_NS,
+    COUNT_
+};
+
+inline const char* metricName(MetricCounter c) {
+    static const char* names[] = {
+        "hashmap.get", "hashmap.put", "hashmap.remove", "hashmap.probes", "hashmap.rehash",
+        "heap.push", "heap.pop", "heap.sift_steps",
+        "trie.insert", "trie.autocomplete", "trie.fuzzy", "trie.nodes_visited",
+        "sort.calls", "sort.comparisons", "sort.moves",
+        "graph.traversals", "graph.nodes_expanded", "graph.edges_scanned"
+    };
+    return names[static_cast<int>(c)];
+}
+
+inline const char* metricName(MetricHistogram h) {
+    static const char* names[] = {
+        "hashmap.probes_per_lookup", "hashmap.chain_length",
+        "hashmap.get_ns", "hashmap.put_ns", "hashmap.remove_ns",
+        "heap.sift_depth", "heap.push_ns", "heap.pop_ns",
+        "trie.nodes_per_query", "trie.autocomplete_ns", "trie.fuzzy_ns",
+        "sort.ns",
+        "graph.nodes_per_traversal", "graph.traversal_ns"
+    };
+    return names[static_cast<int>(h)];
+}
+
+// ── Log-bucketed histogram ──
+
+class LogHistogram {
+public:
+    static constexpr int BUCKETS = 64;
+
+private:
+    array<atomic<uint64_t>, BUCKETS> buckets_;
+    atomic<uint64_t> count_;
+    atomic<uint64_t> sum_;
+    atomic<uint64_t> max_;
+
+    static int bucketOf(uint64_t v) {
+        int b = 0;
+        while (v) { v >>= 1; ++b; }
+        return b < BUCKETS ? b : BUCKETS - 1;
+    }
+
+public:
+    LogHistogram() { reset(); }
+
+    void record(uint64_t v) {
+        buckets_[bucketOf(v)].fetch_add(1, memory_order_relaxed);
+        count_.fetch_add(1, memory_order_relaxed);
+        sum_.fetch_add(v, memory_order_relaxed);
+        uint64_t m = max_.load(memory_order_relaxed);
+        while (v > m && !max_.compare_exchange_weak(m, v, memory_order_relaxed)) {}
+    }
+
+    void reset() {
+        for (auto& b : buckets_) b.store(0, memory_order_relaxed);
+        count_.store(0, memory_order_relaxed);
+        sum_.store(0, memory_order_relaxed);
+        max_.store(0, memory_order_relaxed);
+    }
+
+    uint64_t count()  const { return count_.load(memory_order_relaxed); }
+    uint64_t sum()    const { return sum_.load(memory_order_relaxed); }
+    uint64_t max()    const { return max_.load(memory_order_relaxed); }
+    uint64_t bucket(int b) const { return buckets_[b].load(memory_order_relaxed); }
+    double   mean()   const { return count() ? static_cast<double>(sum()) / count() : 0.0; }
+
+    // exclusive upper bound of bucket b
+    static uint64_t bucketLimit(int b) { return b >= 63 ? UINT64_MAX : (1ULL << b); }
+
+    // upper bound of the bucket holding quantile q (0 < q ≤ 1)
+    uint64_t percentile(double q) const {
+        uint64_t n = count();
+        if (n == 0) return 0;
+        uint64_t target = static_cast<uint64_t>(q * n + 0.5), seen = 0;
+        if (target == 0) target = 1;
+        for (int b = 0; b < BUCKETS; ++b) {
+            seen += bucket(b);
+            if (seen >= target) return b == 0 ? 0 : min(bucketLimit(b) - 1, max());
+        }
+        return max();
+    }
+};
+
+// ── Registry ──
+
+class MetricsRegistry {
+private:
+    array<atomic<uint64_t>, static_cast<size_t>(MetricCounter::COUNT_)> counters_;
+    array<LogHistogram, static_cast<size_t>(MetricHistogram::COUNT_)>  histograms_;
+
+public:
+    MetricsRegistry() { reset(); }
+
+    void add(MetricCounter c, uint64_t n = 1) {
+        counters_[static_cast<size_t>(c)].fetch_add(n, memory_order_relaxed);
+    }
+
+    void record(MetricHistogram h, uint64_t v) {
+        histograms_[static_cast<size_t>(h)].record(v);
+    }
+
+    uint64_t counter(MetricCounter c) const {
+        return counters_[static_cast<size_t>(c)].load(memory_order_relaxed);
+    }
+
+    const LogHistogram& histogram(MetricHistogram h) const {
+        return histograms_[static_cast<size_t>(h)];
+    }
+
+    void reset() {
+        for (auto& c : counters_) c.store(0, memory_order_relaxed);
+        for (auto& h : histograms_) h.reset();
+    }
+
+    static constexpr bool enabled() { return DSA_METRICS != 0; }
+
+    // ── Export — text ──
+    void printMetrics(ostream& os = cout) const {
+        os << "\n╔══════════════════════════════════════════╗\n"
+           << "║           ENGINE METRICS                 ║\n"
+           << "╠══════════════════════════════════════════╣\n";
+        if (!enabled())
+            os << "║ (disabled — rebuild with make METRICS=1)\n";
+        for (int i = 0; i < static_cast<int>(MetricCounter::COUNT_); ++i) {
+            uint64_t v = counters_[i].load(memory_order_relaxed);
+            if (v) os << "║ " << metricName(static_cast<MetricCounter>(i)) << ": " << v << "\n";
+        }
+        for (int i = 0; i < static_cast<int>(MetricHistogram::COUNT_); ++i) {
+            const LogHistogram& h = histograms_[i];
+            if (!h.count()) continue;
+            os << "║ " << metricName(static_cast<MetricHistogram>(i))
+               << ": n=" << h.count() << " mean=" << static_cast<uint64_t>(h.mean())
+               << " p50≤" << h.percentile(0.50) << " p99≤" << h.percentile(0.99)
+               << " max=" << h.max() << "\n";
+        }
+        os << "╚══════════════════════════════════════════╝\n";
+    }
+
+    // ── Export — JSON ──
+    string toJson() const {
+        ostringstream os;
+        os << "{\"enabled\": " << (enabled() ? "true" : "false") << ", \"counters\": {";
+        for (int i = 0; i < static_cast<int>(MetricCounter::COUNT_); ++i)
+            os << (i ? ", " : "") << "\"" << metricName(static_cast<MetricCounter>(i))
+               << "\": " << counters_[i].load(memory_order_relaxed);
+        os << "}, \"histograms\": {";
+        for (int i = 0; i < static_cast<int>(MetricHistogram::COUNT_); ++i) {
+            const LogHistogram& h = histograms_[i];
+            os << (i ? ", " : "") << "\"" << metricName(static_cast<MetricHistogram>(i))
+               << "\": {\"count\": " << h.count() << ", \"sum\": " << h.sum()
+               << ", \"max\": " << h.max() << ", \"p50\": " << h.percentile(0.50)
+               << ", \"p90\": " << h.percentile(0.90) << ", \"p99\": " << h.percentile(0.99)
+               << ", \"buckets\": [";
+            bool first = true;
+            for (int b = 0; b < LogHistogram::BUCKETS; ++b) {
+                uint64_t c = h.bucket(b);
+                if (!c) continue;
+                os << (first ? "" : ", ") << "[" << LogHistogram::bucketLimit(b) << ", " << c << "]";
+                first = false;
+            }
+            os << "]}";
+        }
+        os << "}}";
+        return os.str();
+    }
+};
+
+inline MetricsRegistry& metrics() {
+    static MetricsRegistry registry;
+    return registry;
+}
+
+// ── Scoped latency timer ──
+
+class ScopedMetricTimer {
+private:
+    MetricHistogram hist_;
+    chrono::steady_clock::time_point start_;
+
+public:
+    explicit ScopedMetricTimer(MetricHistogram h)
+        : hist_(h), start_(chrono::steady_clock::now()) {}
+
+    ~ScopedMetricTimer() {
+        auto ns = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start_);
+        metrics().record(hist_, static_cast<uint64_t>(ns.count()));
+    }
+};
+
+// wraps a callable so each call bumps a counter
+template <typename Fn>
+auto countCalls(Fn fn, MetricCounter c) {
+    return [fn, c](const auto&... args) {
+        metrics().add(c);
+        return fn(args...);
+    };
+}
+
+} // namespace dsa
+
+// ── Hooks — compile to nothing unless DSA_METRICS is set ──
+
+#define DSA_METRIC_CONCAT_(a, b) a##b
+#define DSA_METRIC_CONCAT(a, b)  DSA_METRIC_CONCAT_(a, b)
+
+#if DSA_METRICS
+#define DSA_METRIC_ADD(c, n)      ::dsa::metrics().add(::dsa::MetricCounter::c, static_cast<uint64_t>(n))
+#define DSA_METRIC_RECORD(h, v)   ::dsa::metrics().record(::dsa::MetricHistogram::h, static_cast<uint64_t>(v))
+#define DSA_METRIC_TIMER(h)       ::dsa::ScopedMetricTimer DSA_METRIC_CONCAT(dsaMetricTimer_, __LINE__)(::dsa::MetricHistogram::h)
+#define DSA_METRIC_COUNT_CALLS(fn, c) fn = ::dsa::countCalls(fn, ::dsa::MetricCounter::c)
+#else
+// sizeof keeps local tallies "used" without evaluating anything
+#define DSA_METRIC_ADD(c, n)      ((void)sizeof(n))
+#define DSA_METRIC_RECORD(h, v)   ((void)sizeof(v))
+#define DSA_METRIC_TIMER(h)       ((void)0)
+#define DSA_METRIC_COUNT_CALLS(fn, c) ((void)0)
+#endif
+
+#endif // METRICS_H
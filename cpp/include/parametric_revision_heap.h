@@ -0,0 +1,256 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Time-Parametric Revision Heap
+
+   getPriorityScore(today) = rate × today + offset, where
+   rate = diffMult × streakPen has six possible values (3 difficulties
+   × 2 streak bands) and offset does not depend on today. So:
+
+     • one RevisionHeap per rate class, keyed by offset — the order
+       inside a class is the same on every day
+     • the front on any day is the best of six class tops, each
+       evaluated at that day
+
+   Nothing is re-keyed when the date changes: top(today) / pop(today)
+   take the day as an argument and every heap stays valid.
+
+   A question counts from the first day RevisionHeap's day-bound build
+   would queue it (score >= 0). Until then it waits in a seventh heap
+   keyed by that day, and top / pop / topK(today) first move everything
+   due by `today` into its class — so the front on any day is the
+   day-bound heap's front. Each question moves once; days passed in are
+   expected not to go backwards (an earlier day still sees what a later
+   one promoted).
+
+   Time:  push / remove → O(log n)   |   top(today) → O(6) + promotions
+          pop(today) → O(log n)      |   topK → O(6 k log k)
+          promotion → O(log n), once per question
+          Build → O(n), once — never again at midnight
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef PARAMETRIC_REVISION_HEAP_H
+#define PARAMETRIC_REVISION_HEAP_H
+
+#include "revision_heap.h"
+
+using namespace std;
+
+namespace dsa {
+
+class ParametricRevisionHeap {
+public:
+    static constexpr int RATE_CLASSES = 6;
+
+    // difficulty × streak band; index order is irrelevant to the result
+    static int rateClass(const Question& q) {
+        return static_cast<int>(q.difficulty) * 2 + (q.streak < 3 ? 0 : 1);
+    }
+
+    static double classRate(int c) {
+        return Question::priorityDiffMult(static_cast<Difficulty>(c / 2))
+             * Question::priorityStreakPen(c % 2 ? 3 : 0);
+    }
+
+    // First day whose score is >= 0 — the score only grows with the day
+    static int32_t firstDueDay(const Question& q) {
+        double est = ceil(-q.priorityOffset() / q.priorityRate());
+        int32_t d = static_cast<int32_t>(max(-1e9, min(1e9, est)));
+        while (q.getPriorityScore(EpochDay(d - 1)) >= 0) --d;     // est may be off by rounding
+        while (q.getPriorityScore(EpochDay(d)) < 0) ++d;
+        return d;
+    }
+
+private:
+    vector<RevisionHeap> heaps_;       // rate class → heap keyed by offset
+    RevisionHeap         waiting_;     // not yet due, keyed by firstDueDay
+    EpochDay             seen_;        // latest day promoted up to
+
+    static bool schedulable(const Question& q) {
+        return q.status != QuestionStatus::MASTERED && !q.nextRevisionDate.empty();
+    }
+
+    // move everything due by `today` from waiting_ into its class heap
+    void promote(EpochDay today) {
+        if (today <= seen_) return;
+        seen_ = today;
+        while (!waiting_.empty() && waiting_.top().priorityScore <= today.days) {
+            const Question& q = waiting_.top().question;
+            heaps_[rateClass(q)].pushKeyed(q, q.priorityOffset());
+            waiting_.discardTop();
+        }
+    }
+
+    int dueSize() const {
+        int n = 0;
+        for (const auto& h : heaps_) n += h.size();
+        return n;
+    }
+
+    // class whose front scores lowest on `today`, or -1 if all are empty
+    int bestClass(EpochDay today) const {
+        int best = -1;
+        double bestScore = 0;
+        for (int c = 0; c < RATE_CLASSES; ++c) {
+            if (heaps_[c].empty()) continue;
+            double s = classRate(c) * today.days + heaps_[c].top().priorityScore;
+            if (best < 0 || s < bestScore) { best = c; bestScore = s; }
+        }
+        return best;
+    }
+
+public:
+    explicit ParametricRevisionHeap(pmr::memory_resource* mr = pmr::get_default_resource())
+        : waiting_(mr) {
+        heaps_.reserve(RATE_CLASSES);
+        for (int c = 0; c < RATE_CLASSES; ++c) heaps_.emplace_back(mr);
+    }
+
+    // Borrows `deck` (see RevisionHeap::borrowing): seven O(n) builds, one
+    // per class plus the waiting heap. Without a day, everything waits
+    // until the first top / pop / topK.
+    explicit ParametricRevisionHeap(const vector<Question>& deck,
+                                    pmr::memory_resource* mr = pmr::get_default_resource())
+        : ParametricRevisionHeap(deck, EpochDay(), mr) {}
+
+    ParametricRevisionHeap(const vector<Question>& deck, EpochDay today,
+                           pmr::memory_resource* mr = pmr::get_default_resource())
+        : waiting_(RevisionHeap::borrowing(deck, mr)), seen_(today) {
+        heaps_.reserve(RATE_CLASSES);
+        for (int c = 0; c < RATE_CLASSES; ++c) {
+            heaps_.push_back(RevisionHeap::borrowing(deck, mr));
+            heaps_.back().rebuildKeyed([c, today](const Question& q, double& key) {
+                if (!schedulable(q) || rateClass(q) != c || q.getPriorityScore(today) < 0) return false;
+                key = q.priorityOffset();
+                return true;
+            });
+        }
+        waiting_.rebuildKeyed([today](const Question& q, double& key) {
+            if (!schedulable(q) || q.getPriorityScore(today) >= 0) return false;
+            key = firstDueDay(q);
+            return true;
+        });
+    }
+    ParametricRevisionHeap(vector<Question>&&, pmr::memory_resource* = nullptr) = delete;
+    ParametricRevisionHeap(vector<Question>&&, EpochDay, pmr::memory_resource* = nullptr) = delete;
+
+    // ── Insert / re-score — no day needed ──
+    // Returns false (and drops the id) for questions with nothing to schedule.
+    bool push(const Question& q) {
+        RevisionHeap* target = !schedulable(q) ? nullptr
+                             : q.getPriorityScore(seen_) < 0 ? &waiting_
+                             : &heaps_[rateClass(q)];
+        auto drop = [&](RevisionHeap& h) {            // class or due state changed
+            if (&h != target && !h.empty() && h.containsQuestion(q)) h.remove(q.id);
+        };
+        for (auto& h : heaps_) drop(h);
+        drop(waiting_);
+        if (!target) return false;
+        target->pushKeyed(q, target == &waiting_ ? firstDueDay(q) : q.priorityOffset());
+        return true;
+    }
+
+    bool remove(const string& qid) {
+        for (auto& h : heaps_)
+            if (h.remove(qid)) return true;
+        return waiting_.remove(qid);
+    }
+
+    bool contains(const string& qid) const {
+        for (const auto& h : heaps_)
+            if (h.contains(qid)) return true;
+        return waiting_.contains(qid);
+    }
+
+    // decrease- or increase-key; `today` is not needed
+    void updatePriority(const string& qid, const Question& updated) {
+        if (updated.id != qid) remove(qid);
+        push(updated);
+    }
+
+    // ── Front on a given day — only questions due by then ──
+    HeapRef top(EpochDay today) {
+        promote(today);
+        int c = bestClass(today);
+        if (c < 0) throw runtime_error("ParametricRevisionHeap::top() — nothing due!");
+        const Question& q = heaps_[c].top().question;
+        return {q, q.getPriorityScore(today)};
+    }
+
+    HeapEntry pop(EpochDay today) {
+        promote(today);
+        int c = bestClass(today);
+        if (c < 0) throw runtime_error("ParametricRevisionHeap::pop() — nothing due!");
+        HeapEntry e = heaps_[c].pop();
+        e.priorityScore = e.question.getPriorityScore(today);
+        return e;
+    }
+
+    void discardTop(EpochDay today) {
+        promote(today);
+        int c = bestClass(today);
+        if (c < 0) throw runtime_error("ParametricRevisionHeap::discardTop() — nothing due!");
+        heaps_[c].discardTop();
+    }
+
+    // k best on `today`: k from each class, merged — read-only past promotion
+    vector<HeapEntry> topK(int k, EpochDay today) {
+        promote(today);
+        vector<pair<double, const Question*>> cand;
+        for (const auto& h : heaps_)
+            h.forEachTop(k, [&](const Question& q, double) {
+                cand.emplace_back(q.getPriorityScore(today), &q);
+            });
+        size_t cnt = min(cand.size(), static_cast<size_t>(max(k, 0)));
+        partial_sort(cand.begin(), cand.begin() + static_cast<ptrdiff_t>(cnt), cand.end(),
+                     [](const pair<double, const Question*>& a, const pair<double, const Question*>& b) {
+                         return a.first < b.first;
+                     });
+        vector<HeapEntry> out;
+        out.reserve(cnt);
+        for (size_t i = 0; i < cnt; ++i) out.emplace_back(*cand[i].second, cand[i].first);
+        return out;
+    }
+
+    // ── Stats ──
+    // every question held, due or not
+    int size() const { return dueSize() + waiting_.size(); }
+
+    bool empty() const { return size() == 0; }
+
+    // questions top / pop can return on `today`
+    int dueCount(EpochDay today) {
+        promote(today);
+        return dueSize();
+    }
+
+    size_t memoryBytes() const {
+        size_t b = waiting_.memoryBytes();
+        for (const auto& h : heaps_) b += h.memoryBytes();
+        return b;
+    }
+
+    bool isValidHeap() const {
+        for (const auto& h : heaps_)
+            if (!h.isValidHeap()) return false;
+        return waiting_.isValidHeap();
+    }
+
+    void printStats(EpochDay today) {
+        promote(today);
+        cout << "\n╔══════════════════════════════════════════╗\n"
+             << "║     PARAMETRIC REVISION HEAP (6 rates)   ║\n"
+             << "╠══════════════════════════════════════════╣\n";
+        for (int c = 0; c < RATE_CLASSES; ++c)
+            cout << "║ " << difficultyToString(static_cast<Difficulty>(c / 2))
+                 << (c % 2 ? " streak≥3" : " streak<3")
+                 << " | rate " << fixed << setprecision(2) << classRate(c)
+                 << " | " << heaps_[c].size() << " queued\n";
+        cout << "║ Not yet due: " << waiting_.size() << "\n"
+             << "║ Front on " << today << ": "
+             << (dueSize() == 0 ? string("—") : top(today).question.name) << "\n"
+             << "╚══════════════════════════════════════════╝\n";
+    }
+};
+
+} // namespace dsa
+
+#endif // PARAMETRIC_REVISION_HEAP_H
@@ -0,0 +1,154 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — String Hashers for the Question Maps
+
+   Djb2Hash     : h * 33 + c, one byte at a time — the original hash,
+                  kept for comparison. Equal-hash key families are easy
+                  to build ("Az" and "BY" collide, so does every
+                  concatenation of them).
+   WyHash       : wyhash v4.2 (Wang Yi, public domain) — 8 / 16 / 48
+                  bytes per step folded with 64×64→128 multiplies.
+                  Passes SMHasher.
+   SeededWyHash : WyHash keyed from std::random_device per instance, so
+                  colliding key sets can't be precomputed against it.
+                  Use it when ids come from users.
+
+   Hashers are stateless-or-small function objects with a const
+   size_t operator()(string_view); QuestionHashMap takes one as a
+   template parameter. Reads are little-endian (x86 / ARM).
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef QUESTION_HASH_H
+#define QUESTION_HASH_H
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string_view>
+
+using namespace std;
+
+namespace dsa {
+
+// ── djb2 by Dan Bernstein ──
+
+struct Djb2Hash {
+    static constexpr const char* NAME = "djb2";
+
+    size_t operator()(string_view key) const {
+        unsigned long h = 5381;
+        for (char c : key)
+            h = ((h << 5) + h) + static_cast<unsigned long>(c);
+        return h;
+    }
+};
+
+// ── wyhash ──
+
+class WyHash {
+public:
+    static constexpr const char* NAME = "wyhash";
+
+private:
+    static constexpr uint64_t P0 = 0x2d358dccaa6c78a5ULL;
+    static constexpr uint64_t P1 = 0x8bb84b93962eacc9ULL;
+    static constexpr uint64_t P2 = 0x4b33a62ed433d4a3ULL;
+    static constexpr uint64_t P3 = 0x4d5a2da51de1aa47ULL;
+
+    uint64_t seed_;
+
+    // 64×64 → 128, low half into a, high half into b
+    static void mum(uint64_t& a, uint64_t& b) {
+#ifdef __SIZEOF_INT128__
+        __uint128_t r = static_cast<__uint128_t>(a) * b;
+        a = static_cast<uint64_t>(r);
+        b = static_cast<uint64_t>(r >> 64);
+#else
+        uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a), lb = static_cast<uint32_t>(b);
+        uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+        uint64_t t = rl + (rm0 << 32), c = t < rl;
+        uint64_t lo = t + (rm1 << 32);
+        c += lo < t;
+        uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+        a = lo;
+        b = hi;
+#endif
+    }
+
+    static uint64_t mix(uint64_t a, uint64_t b) { mum(a, b); return a ^ b; }
+
+    static uint64_t r8(const unsigned char* p) { uint64_t v; memcpy(&v, p, 8); return v; }
+    static uint64_t r4(const unsigned char* p) { uint32_t v; memcpy(&v, p, 4); return v; }
+    static uint64_t r3(const unsigned char* p, size_t k) {
+        return (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[k >> 1]) << 8) | p[k - 1];
+    }
+
+public:
+    constexpr explicit WyHash(uint64_t seed = 0) : seed_(seed) {}
+
+    uint64_t seed() const { return seed_; }
+
+    size_t operator()(string_view key) const {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(key.data());
+        size_t len = key.size();
+        uint64_t seed = seed_ ^ mix(seed_ ^ P0, P1);
+        uint64_t a, b;
+
+        if (len <= 16) {
+            if (len >= 4) {
+                size_t off = (len >> 3) << 2;
+                a = (r4(p) << 32) | r4(p + off);
+                b = (r4(p + len - 4) << 32) | r4(p + len - 4 - off);
+            } else if (len > 0) {
+                a = r3(p, len);
+                b = 0;
+            } else {
+                a = b = 0;
+            }
+        } else {
+            size_t i = len;
+            if (i > 48) {
+                uint64_t see1 = seed, see2 = seed;
+                do {
+                    seed = mix(r8(p) ^ P1, r8(p + 8) ^ seed);
+                    see1 = mix(r8(p + 16) ^ P2, r8(p + 24) ^ see1);
+                    see2 = mix(r8(p + 32) ^ P3, r8(p + 40) ^ see2);
+                    p += 48;
+                    i -= 48;
+                } while (i > 48);
+                seed ^= see1 ^ see2;
+            }
+            while (i > 16) {
+                seed = mix(r8(p) ^ P1, r8(p + 8) ^ seed);
+                i -= 16;
+                p += 16;
+            }
+            a = r8(p + i - 16);
+            b = r8(p + i - 8);
+        }
+
+        a ^= P1;
+        b ^= seed;
+        mum(a, b);
+        return static_cast<size_t>(mix(a ^ P0 ^ len, b ^ P1));
+    }
+};
+
+// ── wyhash with a per-instance random key ──
+
+class SeededWyHash : public WyHash {
+public:
+    static constexpr const char* NAME = "wyhash-seeded";
+
+    SeededWyHash() : WyHash(randomSeed()) {}
+    explicit SeededWyHash(uint64_t seed) : WyHash(seed) {}
+
+private:
+    static uint64_t randomSeed() {
+        random_device rd;
+        return (static_cast<uint64_t>(rd()) << 32) ^ rd();
+    }
+};
+
+} // namespace dsa
+
+#endif // QUESTION_HASH_H
@@ -2,150 +2,675 @@
    DSA Tracker — Custom Hash Map for O(1) Question Lookup
    
    Data Structure : Hash Table with Separate Chaining
-   Hash Function  : djb2 by Dan Bernstein
+   Hash Function  : template parameter (question_hash.h) — wyhash by
+                    default; Djb2Hash / SeededWyHash also available
    
    Time:  Insert / Get / Delete → O(1) average
    Space: O(n + m) where m = bucket count
+
+   Incremental rehashing: past the load threshold a table of twice the
+   size is allocated and the old buckets are spliced over a few at a
+   time by later put / remove / operator[] calls, so no single insert
+   pays for moving the whole map. While both tables are live, a key
+   lives in its old bucket until that bucket has been migrated.
+
+   Bulk loading: reserve(n) sizes the table once; build() moves a whole
+   deck in, hashing and grouping by bucket on several threads and then
+   linking nodes in bucket order on the calling thread (the memory
+   resource need not be thread-safe).
+
+   Optional secondary indexes (enableIndexes()) keep posting lists
+   per subject / platform / difficulty / status / tag in step with
+   put / remove / update — see question_index.h. Edits through a
+   pointer from find() / operator[] are picked up by the next indexed
+   query only; update(key, fn) is the safe way to edit later.
    ═══════════════════════════════════════════════════════════════════ */
 
 #ifndef QUESTION_HASHMAP_H
 #define QUESTION_HASHMAP_H
 
 #include "dsa_core.h"
+#include "metrics.h"
+#include "range_view.h"
+#include "question_index.h"
+#include "question_hash.h"
 #include <list>
 #include <utility>
 #include <cassert>
+#include <memory>
+#include <memory_resource>
+#include <thread>
 
 using namespace std;
 
 namespace dsa {
 
-class QuestionHashMap {
+template <typename Hasher = WyHash>
+class BasicQuestionHashMap {
 private:
-    using Entry  = pair<string, Question>;
-    using Bucket = list<Entry>;
+    struct Entry {
+        string   first;
+        Question second;
+        uint32_t slot;                     // position in index_, when enabled
+
+        Entry(const string& k, Question q) : first(k), second(move(q)), slot(QuestionIndex::NONE) {}
+        explicit Entry(Question q) : first(q.id), second(move(q)), slot(QuestionIndex::NONE) {}
+    };
+    using Bucket = pmr::list<Entry>;       // nodes come from the map's memory resource
 
     static constexpr double LOAD_THRESHOLD = 0.75;
     static constexpr int    INIT_CAP       = 16;
-
-    vector<Bucket> buckets_;
+    static constexpr int    MIGRATE_NONEMPTY = 4;    // chains moved per write...
+    static constexpr int    MIGRATE_VISITS   = 64;   // ...or old buckets looked at
+    static constexpr size_t PARALLEL_MIN     = 1 << 15;  // build(): below this, one thread
+    static constexpr int    BUILD_PARTITIONS = 1 << 12;  // build(): bucket-order groups
+
+    // Bucket arrays are raw storage. While rehashing, only the live
+    // ranges hold constructed lists:
+    //   old_     [migrated_, oldCap_)        — not yet moved
+    //   buckets_ [0, migrated_) and [oldCap_, oldCap_ + migrated_)
+    // Old bucket j splits into new buckets j and j + oldCap_ (capacity
+    // doubles), so a new bucket is built right before it is first used
+    // and neither table is initialised or torn down in one go.
+    pmr::memory_resource* mr_;
+    Bucket* buckets_;
+    Bucket* old_;
+    int migrated_;
+    int oldCap_;
     int size_;
     int capacity_;
-    int collisions_;
+    int collisions_;                       // Σ (chain length − 1) over both tables
+    unique_ptr<QuestionIndex> index_;      // null unless enableIndexes()
+    Hasher hash_;
+
+    int index(string_view key) const { return indexOfHash(hash_(key)); }
 
-    // djb2 hash: hash * 33 + c
-    static unsigned long djb2(const string& key) {
-        unsigned long h = 5381;
-        for (char c : key)
-            h = ((h << 5) + h) + static_cast<unsigned long>(c);
-        return h;
+    int indexOfHash(size_t h) const {
+        return static_cast<int>(h % static_cast<unsigned long>(capacity_));
     }
 
-    int index(const string& key) const {
-        return static_cast<int>(djb2(key) % static_cast<unsigned long>(capacity_));
+    bool rehashing() const { return old_ != nullptr; }
+
+    // ── Raw bucket storage ──
+    Bucket* allocBuckets(int n) {
+        return static_cast<Bucket*>(mr_->allocate(sizeof(Bucket) * static_cast<size_t>(n), alignof(Bucket)));
+    }
+
+    void freeBuckets(Bucket* p, int n) {
+        mr_->deallocate(p, sizeof(Bucket) * static_cast<size_t>(n), alignof(Bucket));
     }
 
-    void rehash() {
-        int newCap = capacity_ * 2;
-        vector<Bucket> newBuckets(newCap);
+    void construct(Bucket* p, int from, int to) {
+        for (int i = from; i < to; ++i) new (p + i) Bucket(mr_);
+    }
 
-        for (auto& bucket : buckets_)
-            for (auto& entry : bucket) {
-                int idx = static_cast<int>(djb2(entry.first) % static_cast<unsigned long>(newCap));
-                newBuckets[idx].push_back(move(entry));
+    static void destroy(Bucket* p, int from, int to) {
+        for (int i = from; i < to; ++i) p[i].~Bucket();
+    }
+
+    // live bucket ranges, draining table first — at most three
+    struct Span { const Bucket* begin; const Bucket* end; };
+
+    int liveSpans(Span out[3]) const {
+        if (!buckets_) return 0;
+        if (!rehashing()) { out[0] = {buckets_, buckets_ + capacity_}; return 1; }
+        out[0] = {old_ + migrated_, old_ + oldCap_};
+        out[1] = {buckets_, buckets_ + migrated_};
+        out[2] = {buckets_ + oldCap_, buckets_ + oldCap_ + migrated_};
+        return 3;
+    }
+
+    void releaseAll() {
+        if (buckets_) {
+            if (rehashing()) {
+                destroy(old_, migrated_, oldCap_);
+                destroy(buckets_, 0, migrated_);
+                destroy(buckets_, oldCap_, oldCap_ + migrated_);
+                freeBuckets(old_, oldCap_);
+            } else {
+                destroy(buckets_, 0, capacity_);
             }
+            freeBuckets(buckets_, capacity_);
+        }
+        buckets_ = old_ = nullptr;
+        migrated_ = oldCap_ = size_ = capacity_ = collisions_ = 0;
+    }
 
-        buckets_  = move(newBuckets);
-        capacity_ = newCap;
+    void init(int cap) {
+        capacity_ = max(1, cap);
+        buckets_ = allocBuckets(capacity_);
+        construct(buckets_, 0, capacity_);
+    }
+
+    // the one bucket that can hold a key with this hash
+    const Bucket& bucketOf(size_t h) const {
+        if (rehashing()) {
+            size_t oi = h % static_cast<size_t>(oldCap_);
+            if (oi >= static_cast<size_t>(migrated_)) return old_[oi];
+        }
+        return buckets_[indexOfHash(h)];
+    }
+
+    Bucket& bucketOf(size_t h) {
+        return const_cast<Bucket&>(static_cast<const BasicQuestionHashMap*>(this)->bucketOf(h));
+    }
+
+    // chain walk shared by the lookups — records probes when metrics are on
+    const Entry* findEntry(string_view key) const {
+        return size_ ? findEntry(key, hash_(key)) : nullptr;
+    }
+
+    const Entry* findEntry(string_view key, size_t hash) const {
+        if (!size_) return nullptr;
+        const Bucket& b = bucketOf(hash);
+        int probes = 0;
+        const Entry* hit = nullptr;
+        for (const auto& e : b) {
+            ++probes;
+            if (e.first == key) { hit = &e; break; }
+        }
+        DSA_METRIC_ADD(HASHMAP_PROBES, probes);
+        DSA_METRIC_RECORD(HASHMAP_PROBES_PER_LOOKUP, probes);
+        DSA_METRIC_RECORD(HASHMAP_CHAIN_LENGTH, b.size());
+        return hit;
+    }
+
+    // hands out a mutable question — queue it for re-indexing
+    Question* touch(const Entry* e) {
+        if (!e) return nullptr;
+        if (index_) index_->markDirty(e->slot);
+        return const_cast<Question*>(&e->second);
+    }
 
+    // ── Incremental rehash ──
+    //   Nodes are relinked (splice) — no allocation, entries keep their
+    //   addresses. Each write moves up to MIGRATE_NONEMPTY chains, so the
+    //   old table is empty well before the new one reaches the threshold.
+
+    void migrateBucket(int j) {
+        construct(buckets_, j, j + 1);
+        construct(buckets_, j + oldCap_, j + oldCap_ + 1);
+        Bucket& from = old_[j];
+        while (!from.empty()) {
+            Bucket& to = buckets_[index(from.front().first)];
+            if (!to.empty()) collisions_++;
+            to.splice(to.end(), from, from.begin());
+            if (!from.empty()) collisions_--;
+        }
+        from.~Bucket();
+        ++migrated_;
+    }
+
+    void migrateStep() {
+        if (!rehashing()) return;
+        int moved = 0, visits = 0;
+        while (migrated_ < oldCap_ && moved < MIGRATE_NONEMPTY && visits < MIGRATE_VISITS) {
+            if (!old_[migrated_].empty()) ++moved;
+            migrateBucket(migrated_);
+            ++visits;
+        }
+        if (migrated_ == oldCap_) finishRehash();
+    }
+
+    void finishRehash() {
+        while (migrated_ < oldCap_) migrateBucket(migrated_);
+        freeBuckets(old_, oldCap_);
+        old_ = nullptr;
+        migrated_ = oldCap_ = 0;
+    }
+
+    // load-factor policy — runs only once an insert has missed, so an
+    // overwrite never grows the table; may start a new table, so callers
+    // look their bucket up again afterwards
+    void reserveOne() {
+        if (!buckets_) init(INIT_CAP);
+        if (static_cast<double>(size_ + 1) / capacity_ <= LOAD_THRESHOLD) return;
+        if (rehashing()) finishRehash();
+        DSA_METRIC_ADD(HASHMAP_REHASH, 1);
+        old_      = buckets_;
+        oldCap_   = capacity_;
+        migrated_ = 0;
+        buckets_  = allocBuckets(capacity_ * 2);
+        capacity_ *= 2;
+    }
+
+    // one-shot resize to any capacity (reserve / build) — O(n)
+    void resizeNow(int newCap) {
+        if (rehashing()) finishRehash();
+        Bucket* nb = allocBuckets(newCap);
+        construct(nb, 0, newCap);
         collisions_ = 0;
-        for (auto& b : buckets_)
-            if (b.size() > 1)
-                collisions_ += static_cast<int>(b.size()) - 1;
+        for (int i = 0; i < capacity_; ++i) {
+            Bucket& from = buckets_[i];
+            while (!from.empty()) {
+                Bucket& to = nb[hash_(from.front().first) % static_cast<unsigned long>(newCap)];
+                if (!to.empty()) collisions_++;
+                to.splice(to.end(), from, from.begin());
+            }
+        }
+        destroy(buckets_, 0, capacity_);
+        freeBuckets(buckets_, capacity_);
+        buckets_  = nb;
+        capacity_ = newCap;
+    }
+
+    // fn(lo, hi) over [0, n) in contiguous chunks, one per thread
+    template <typename Fn>
+    static void parallelChunks(size_t n, unsigned threads, Fn&& fn) {
+        if (threads <= 1) { fn(size_t(0), n, 0u); return; }
+        vector<thread> pool;
+        size_t chunk = (n + threads - 1) / threads;
+        for (unsigned t = 1; t < threads; ++t)
+            pool.emplace_back([&, t] { fn(min(n, t * chunk), min(n, (t + 1) * chunk), t); });
+        fn(size_t(0), min(n, chunk), 0u);
+        for (auto& th : pool) th.join();
+    }
+
+    template <typename Fn>
+    void eachEntry(Fn&& fn) const {
+        Span spans[3];
+        int n = liveSpans(spans);
+        for (int s = 0; s < n; ++s)
+            for (const Bucket* b = spans[s].begin; b != spans[s].end; ++b)
+                for (const auto& e : *b) fn(e);
+    }
+
+    template <typename Fn>
+    void eachEntry(Fn&& fn) {
+        static_cast<const BasicQuestionHashMap*>(this)->eachEntry(
+            [&](const Entry& e) { fn(const_cast<Entry&>(e)); });
+    }
+
+    void copyFrom(const BasicQuestionHashMap& o) {
+        init(o.capacity_);
+        o.eachEntry([this](const Entry& e) {
+            Bucket& b = buckets_[index(e.first)];
+            if (!b.empty()) collisions_++;
+            b.emplace_back(e.first, e.second);
+        });
+        size_ = o.size_;
+        if (o.index_) enableIndexes();
     }
 
 public:
-    QuestionHashMap()
-        : buckets_(INIT_CAP), size_(0), capacity_(INIT_CAP), collisions_(0) {}
+    // ── Entry iteration (bucket order; the draining table first) ──
+    class const_iterator {
+    private:
+        Span spans_[3];
+        int  span_ = 0, spanCount_ = 0;
+        const Bucket* b_ = nullptr;
+        typename Bucket::const_iterator e_;
+
+        void settle() {
+            for (;;) {
+                if (b_ == spans_[span_].end) {
+                    if (span_ + 1 >= spanCount_) return;
+                    b_ = spans_[++span_].begin;
+                    if (b_ != spans_[span_].end) e_ = b_->begin();
+                    continue;
+                }
+                if (e_ != b_->end()) return;
+                if (++b_ != spans_[span_].end) e_ = b_->begin();
+            }
+        }
 
-    explicit QuestionHashMap(int cap)
-        : buckets_(cap), size_(0), capacity_(cap), collisions_(0) {}
+        bool atEnd() const { return span_ >= spanCount_ || b_ == spans_[span_].end; }
+
+    public:
+        using iterator_category = forward_iterator_tag;
+        using value_type        = Entry;
+        using difference_type   = ptrdiff_t;
+        using pointer           = const Entry*;
+        using reference         = const Entry&;
+
+        const_iterator() = default;
+        explicit const_iterator(const BasicQuestionHashMap& m, bool end = false) {
+            spanCount_ = m.liveSpans(spans_);
+            if (end || spanCount_ == 0) { span_ = spanCount_; return; }
+            b_ = spans_[0].begin;
+            if (b_ != spans_[0].end) e_ = b_->begin();
+            settle();
+            if (atEnd()) span_ = spanCount_;
+        }
 
-    // ── Insert / Update — O(1) avg ──
-    void put(const string& key, const Question& val) {
-        if (static_cast<double>(size_ + 1) / capacity_ > LOAD_THRESHOLD)
-            rehash();
+        reference operator*()  const { return *e_; }
+        pointer   operator->() const { return &*e_; }
+        const_iterator& operator++() {
+            ++e_;
+            settle();
+            if (atEnd()) span_ = spanCount_;
+            return *this;
+        }
+        const_iterator operator++(int) { auto t = *this; ++*this; return t; }
 
-        int idx = index(key);
-        Bucket& b = buckets_[idx];
+        bool operator==(const const_iterator& o) const {
+            bool end = span_ >= spanCount_, oEnd = o.span_ >= o.spanCount_;
+            if (end || oEnd) return end == oEnd;
+            return b_ == o.b_ && e_ == o.e_;
+        }
+        bool operator!=(const const_iterator& o) const { return !(*this == o); }
+    };
+
+    explicit BasicQuestionHashMap(pmr::memory_resource* mr = pmr::get_default_resource(),
+                                  Hasher hasher = Hasher())
+        : BasicQuestionHashMap(INIT_CAP, mr, move(hasher)) {}
+
+    explicit BasicQuestionHashMap(int cap, pmr::memory_resource* mr = pmr::get_default_resource(),
+                                  Hasher hasher = Hasher())
+        : mr_(mr), buckets_(nullptr), old_(nullptr), migrated_(0), oldCap_(0),
+          size_(0), capacity_(0), collisions_(0), hash_(move(hasher)) {
+        init(cap);
+    }
+
+    ~BasicQuestionHashMap() { releaseAll(); }
 
-        for (auto& e : b)
-            if (e.first == key) { e.second = val; return; }
+    // copies entries into a settled table on the default resource (as
+    // pmr containers do); the copy rebuilds its own indexes if the source had them
+    BasicQuestionHashMap(const BasicQuestionHashMap& o)
+        : mr_(pmr::get_default_resource()), buckets_(nullptr), old_(nullptr),
+          migrated_(0), oldCap_(0), size_(0), capacity_(0), collisions_(0), hash_(o.hash_) {
+        copyFrom(o);
+    }
 
+    BasicQuestionHashMap& operator=(const BasicQuestionHashMap& o) {
+        if (this == &o) return *this;
+        index_.reset();
+        releaseAll();
+        hash_ = o.hash_;
+        copyFrom(o);
+        return *this;
+    }
+
+    // steals the tables (and their resource) — the index stays valid; o is
+    // left empty but usable, with its buckets re-allocated by the next insert
+    BasicQuestionHashMap(BasicQuestionHashMap&& o) noexcept
+        : mr_(o.mr_), buckets_(o.buckets_), old_(o.old_), migrated_(o.migrated_),
+          oldCap_(o.oldCap_), size_(o.size_), capacity_(o.capacity_),
+          collisions_(o.collisions_), index_(move(o.index_)), hash_(o.hash_) {
+        o.buckets_ = o.old_ = nullptr;
+        o.migrated_ = o.oldCap_ = o.size_ = o.capacity_ = o.collisions_ = 0;
+    }
+
+    BasicQuestionHashMap& operator=(BasicQuestionHashMap&& o) noexcept {
+        if (this == &o) return *this;
+        index_.reset();
+        releaseAll();
+        mr_ = o.mr_;
+        buckets_ = o.buckets_; old_ = o.old_;
+        migrated_ = o.migrated_; oldCap_ = o.oldCap_;
+        size_ = o.size_; capacity_ = o.capacity_; collisions_ = o.collisions_;
+        index_ = move(o.index_);
+        hash_ = o.hash_;
+        o.buckets_ = o.old_ = nullptr;
+        o.migrated_ = o.oldCap_ = o.size_ = o.capacity_ = o.collisions_ = 0;
+        return *this;
+    }
+
+    pmr::memory_resource* resource() const { return mr_; }
+
+    // ── Secondary indexes — O(n) to build, then maintained incrementally ──
+    void enableIndexes() {
+        if (index_) return;
+        index_ = make_unique<QuestionIndex>();
+        eachEntry([this](Entry& e) { e.slot = index_->add(&e.second); });
+    }
+
+    void disableIndexes() {
+        index_.reset();
+        eachEntry([](Entry& e) { e.slot = QuestionIndex::NONE; });
+    }
+
+    bool hasIndexes() const { return index_ != nullptr; }
+
+    // ── Insert / Update — O(1) avg (pass an rvalue to move instead of copy) ──
+    void put(const string& key, Question val) {
+        DSA_METRIC_ADD(HASHMAP_PUT, 1);
+        DSA_METRIC_TIMER(HASHMAP_PUT_NS);
+        migrateStep();
+        size_t h = hash_(key);
+
+        int probes = 0;
+        if (size_) {
+            for (auto& e : bucketOf(h)) {
+                ++probes;
+                if (e.first == key) {
+                    e.second = move(val);
+                    if (index_) index_->update(e.slot);
+                    DSA_METRIC_ADD(HASHMAP_PROBES, probes);
+                    return;
+                }
+            }
+        }
+        DSA_METRIC_ADD(HASHMAP_PROBES, probes);
+
+        reserveOne();
+        Bucket& b = bucketOf(h);
         if (!b.empty()) collisions_++;
-        b.emplace_back(key, val);
+        b.emplace_back(key, move(val));
+        if (index_) b.back().slot = index_->add(&b.back().second);
         size_++;
     }
 
-    // ── Get — O(1) avg ──
-    pair<bool, Question> get(const string& key) const {
-        int idx = index(key);
-        for (const auto& e : buckets_[idx])
-            if (e.first == key)
-                return {true, e.second};
+    // ── Capacity — sized once so the next n inserts never rehash ──
+    void reserve(int n) {
+        if (n <= 0) return;
+        if (!buckets_) init(INIT_CAP);
+        double need = ceil(static_cast<double>(n) / LOAD_THRESHOLD);
+        if (need > INT_MAX) throw length_error("QuestionHashMap::reserve() — too many entries!");
+        if (static_cast<int>(need) > capacity_) resizeNow(static_cast<int>(need));
+    }
+
+    // ── Bulk load — keyed by question id, moves every question in ──
+    //   Same result as put(q.id, q) for each q in order (a later duplicate id
+    //   wins), but the table is sized once and nodes are linked bucket by
+    //   bucket. Hashing and grouping use `threads` workers (0 = one per
+    //   core) for large decks. Leaves `deck` empty.
+    void build(vector<Question>&& deck, unsigned threads = 0) {
+        size_t n = deck.size();
+        if (n == 0) return;
+        if (n > static_cast<size_t>(INT_MAX - size_))
+            throw length_error("QuestionHashMap::build() — too many entries!");
+        reserve(size_ + static_cast<int>(n));
+        if (rehashing()) finishRehash();
+
+        if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+        if (n < PARALLEL_MIN) threads = 1;
+        threads = static_cast<unsigned>(min<size_t>(threads, n));
+
+        // 1. hash + bucket + partition histogram, per thread
+        vector<uint32_t> bucket(n);
+        vector<size_t>   counts(static_cast<size_t>(threads) * BUILD_PARTITIONS, 0);
+        auto partOf = [this](uint32_t b) {
+            return static_cast<size_t>(static_cast<uint64_t>(b) * BUILD_PARTITIONS / static_cast<uint64_t>(capacity_));
+        };
+        parallelChunks(n, threads, [&](size_t lo, size_t hi, unsigned t) {
+            size_t* c = &counts[static_cast<size_t>(t) * BUILD_PARTITIONS];
+            for (size_t i = lo; i < hi; ++i) {
+                bucket[i] = static_cast<uint32_t>(index(deck[i].id));
+                c[partOf(bucket[i])]++;
+            }
+        });
+
+        // 2. stable scatter into partition order (duplicates keep their order)
+        size_t run = 0;
+        for (int p = 0; p < BUILD_PARTITIONS; ++p)
+            for (unsigned t = 0; t < threads; ++t) {
+                size_t& c = counts[static_cast<size_t>(t) * BUILD_PARTITIONS + p];
+                size_t k = c;
+                c = run;
+                run += k;
+            }
+        vector<uint32_t> order(n);
+        parallelChunks(n, threads, [&](size_t lo, size_t hi, unsigned t) {
+            size_t* c = &counts[static_cast<size_t>(t) * BUILD_PARTITIONS];
+            for (size_t i = lo; i < hi; ++i) order[c[partOf(bucket[i])]++] = static_cast<uint32_t>(i);
+        });
+
+        // 3. link nodes on this thread, walking the bucket array front to back
+        for (uint32_t i : order) {
+            Question& q = deck[i];
+            Bucket& b = buckets_[bucket[i]];
+            Entry* hit = nullptr;
+            for (auto& e : b)
+                if (e.first == q.id) { hit = &e; break; }
+            if (hit) {
+                hit->second = move(q);
+                if (index_) index_->update(hit->slot);
+                continue;
+            }
+            if (!b.empty()) collisions_++;
+            b.emplace_back(move(q));
+            if (index_) b.back().slot = index_->add(&b.back().second);
+            size_++;
+        }
+        deck.clear();
+    }
+
+    // ── Get — O(1) avg (copies; see find() for the zero-copy form) ──
+    pair<bool, Question> get(string_view key) const {
+        DSA_METRIC_ADD(HASHMAP_GET, 1);
+        DSA_METRIC_TIMER(HASHMAP_GET_NS);
+        const Entry* e = findEntry(key);
+        if (e) return {true, e->second};
         return {false, Question()};
     }
 
-    bool contains(const string& key) const {
-        int idx = index(key);
-        for (const auto& e : buckets_[idx])
-            if (e.first == key) return true;
-        return false;
+    bool contains(string_view key) const {
+        DSA_METRIC_ADD(HASHMAP_GET, 1);
+        return findEntry(key) != nullptr;
+    }
+
+    // ── Zero-copy lookup — pointer into the map or nullptr ──
+    //   Stays valid until the entry is removed (rehash relinks nodes only).
+    //   The mutable overloads mark the entry for re-indexing at the next
+    //   indexed query; edits made through the pointer after that query
+    //   are not re-indexed — use update() for those.
+
+    const Question* find(string_view key) const {
+        DSA_METRIC_ADD(HASHMAP_GET, 1);
+        const Entry* e = findEntry(key);
+        return e ? &e->second : nullptr;
+    }
+
+    Question* find(string_view key) {
+        return touch(static_cast<const BasicQuestionHashMap*>(this)->findEntry(key));
+    }
+
+    // hash computed once with hashOf(), reused across lookups / maps
+    // sharing the same hasher (and seed)
+    size_t hashOf(string_view key) const { return hash_(key); }
+    const Hasher& hasher() const { return hash_; }
+
+    const Question* find(string_view key, size_t hash) const {
+        DSA_METRIC_ADD(HASHMAP_GET, 1);
+        const Entry* e = findEntry(key, hash);
+        return e ? &e->second : nullptr;
+    }
+
+    Question* find(string_view key, size_t hash) {
+        return touch(static_cast<const BasicQuestionHashMap*>(this)->findEntry(key, hash));
+    }
+
+    // ── In-place edit — re-indexed before returning ──
+    //   fn(Question&) must not change the id. false if the key is absent.
+    template <typename Fn>
+    bool update(string_view key, Fn&& fn) {
+        const Entry* e = findEntry(key);
+        if (!e) return false;
+        fn(const_cast<Question&>(e->second));
+        if (index_) index_->update(e->slot);
+        return true;
     }
 
     // ── Delete — O(1) avg ──
-    bool remove(const string& key) {
-        int idx = index(key);
-        Bucket& b = buckets_[idx];
-        for (auto it = b.begin(); it != b.end(); ++it)
+    bool remove(string_view key) {
+        DSA_METRIC_ADD(HASHMAP_REMOVE, 1);
+        DSA_METRIC_TIMER(HASHMAP_REMOVE_NS);
+        if (!size_) return false;
+        migrateStep();
+        Bucket& b = bucketOf(hash_(key));
+        int probes = 0;
+        for (auto it = b.begin(); it != b.end(); ++it) {
+            ++probes;
             if (it->first == key) {
+                if (index_) index_->remove(it->slot);
                 b.erase(it);
                 size_--;
                 if (!b.empty()) collisions_--;
+                DSA_METRIC_ADD(HASHMAP_PROBES, probes);
                 return true;
             }
+        }
+        DSA_METRIC_ADD(HASHMAP_PROBES, probes);
         return false;
     }
 
-    // ── Bulk Access ──
+    // ── Lazy views — no copies, nothing allocated ──
+    const_iterator begin() const { return const_iterator(*this); }
+    const_iterator end()   const { return const_iterator(*this, true); }
+
+    QuestionFilterRange<const_iterator, AcceptAll> questions() const {
+        return {begin(), end(), AcceptAll()};
+    }
+
+    template <typename Pred>
+    QuestionFilterRange<const_iterator, Pred> where(Pred pred) const {
+        return {begin(), end(), move(pred)};
+    }
+
+    // ── Bulk Access (copying) ──
     vector<Question> getAllQuestions() const {
         vector<Question> out;
         out.reserve(size_);
-        for (const auto& b : buckets_)
-            for (const auto& e : b)
-                out.push_back(e.second);
+        eachEntry([&](const Entry& e) { out.push_back(e.second); });
         return out;
     }
 
     vector<Question> filter(function<bool(const Question&)> pred) const {
         vector<Question> out;
-        for (const auto& b : buckets_)
-            for (const auto& e : b)
-                if (pred(e.second))
-                    out.push_back(e.second);
+        eachEntry([&](const Entry& e) { if (pred(e.second)) out.push_back(e.second); });
         return out;
     }
 
     vector<Question> getBySubject(const string& subj) const {
-        return filter([&](const Question& q) { return q.subject == subj; });
+        return select(IndexQuery().withSubject(subj));
     }
 
     vector<Question> getByDifficulty(Difficulty d) const {
-        return filter([d](const Question& q) { return q.difficulty == d; });
+        return select(IndexQuery().withDifficulty(d));
     }
 
     vector<Question> getByStatus(QuestionStatus s) const {
-        return filter([s](const Question& q) { return q.status == s; });
+        return select(IndexQuery().withStatus(s));
+    }
+
+    // ── Combined predicates — O(narrowest posting list) when indexed, O(n) scan otherwise ──
+    //   e.g. query(IndexQuery().withDifficulty(Difficulty::HARD)
+    //                          .withStatus(QuestionStatus::NEEDS_REVISION)
+    //                          .withSubject("Graphs"))
+    vector<const Question*> query(const IndexQuery& iq) const {
+        if (index_) return index_->query(iq);
+        vector<const Question*> out;
+        eachEntry([&](const Entry& e) { if (iq.matches(e.second)) out.push_back(&e.second); });
+        return out;
+    }
+
+    size_t count(const IndexQuery& iq) const {
+        if (index_) return index_->count(iq);
+        size_t n = 0;
+        eachEntry([&](const Entry& e) { if (iq.matches(e.second)) ++n; });
+        return n;
+    }
+
+    // copying form of query()
+    vector<Question> select(const IndexQuery& iq) const {
+        vector<Question> out;
+        if (index_) {
+            index_->forEach(iq, [&](const Question& q) { out.push_back(q); });
+            return out;
+        }
+        eachEntry([&](const Entry& e) { if (iq.matches(e.second)) out.push_back(e.second); });
+        return out;
     }
 
     // ── Stats ──
@@ -153,41 +678,63 @@ public:
     bool empty()      const { return size_ == 0; }
     int  capacity()   const { return capacity_; }
     int  collisionCount() const { return collisions_; }
-    double loadFactor() const { return static_cast<double>(size_) / capacity_; }
+    double loadFactor() const { return capacity_ ? static_cast<double>(size_) / capacity_ : 0.0; }
+
+    // bucket occupancy over the live buckets (both tables while rehashing)
+    struct ChainStats { int buckets, used, empty, maxChain, collisions; };
+
+    ChainStats chainStats() const {
+        ChainStats st{0, 0, 0, 0, collisions_};
+        Span spans[3];
+        int n = liveSpans(spans);
+        for (int s = 0; s < n; ++s)
+            for (const Bucket* b = spans[s].begin; b != spans[s].end; ++b) {
+                st.buckets++;
+                if (b->empty()) st.empty++;
+                else {
+                    st.used++;
+                    st.maxChain = max(st.maxChain, static_cast<int>(b->size()));
+                }
+            }
+        return st;
+    }
 
     void printStats() const {
-        int emptyB = 0, maxChain = 0, usedB = 0;
-        for (const auto& b : buckets_) {
-            if (b.empty()) emptyB++;
-            else {
-                usedB++;
-                int len = static_cast<int>(b.size());
-                if (len > maxChain) maxChain = len;
-            }
-        }
+        ChainStats st = chainStats();
         cout << "\n╔══════════════════════════════════════════╗\n"
              << "║     QUESTION HASH MAP (Separate Chain)   ║\n"
              << "╠══════════════════════════════════════════╣\n"
              << "║ Size: " << size_ << " | Capacity: " << capacity_ << "\n"
+             << "║ Hash: " << Hasher::NAME << "\n"
              << "║ Load Factor: " << fixed << setprecision(3) << loadFactor() << "\n"
-             << "║ Used Buckets: " << usedB << " / " << capacity_ << "\n"
-             << "║ Empty Buckets: " << emptyB << "\n"
-             << "║ Collisions: " << collisions_ << "\n"
-             << "║ Max Chain Length: " << maxChain << "\n"
-             << "╚══════════════════════════════════════════╝\n";
+             << "║ Used Buckets: " << st.used << " / " << st.buckets << "\n"
+             << "║ Empty Buckets: " << st.empty << "\n"
+             << "║ Collisions: " << st.collisions << "\n"
+             << "║ Max Chain Length: " << st.maxChain << "\n";
+        if (rehashing())
+            cout << "║ Rehashing: " << migrated_ << " / " << oldCap_ << " old buckets moved\n";
+        cout << "╚══════════════════════════════════════════╝\n";
     }
 
+    // mutable access — re-indexed lazily, at the next query (see find())
     Question& operator[](const string& key) {
-        int idx = index(key);
-        Bucket& b = buckets_[idx];
-        for (auto& e : b)
-            if (e.first == key) return e.second;
+        migrateStep();
+        size_t h = hash_(key);
+        if (size_)
+            for (auto& e : bucketOf(h))
+                if (e.first == key) return *touch(&e);
+        reserveOne();
+        Bucket& b = bucketOf(h);
+        if (!b.empty()) collisions_++;
         b.emplace_back(key, Question());
+        if (index_) b.back().slot = index_->add(&b.back().second);
         size_++;
-        return b.back().second;
+        return *touch(&b.back());
     }
 };
 
+using QuestionHashMap = BasicQuestionHashMap<>;
+
 } // namespace dsa
 
 #endif // QUESTION_HASHMAP_H
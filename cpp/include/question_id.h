@@ -0,0 +1,146 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Compact 64-bit Question IDs
+
+   Generator : global atomic counter handed out in per-thread blocks,
+               so the hot path is a thread-local increment (no atomics,
+               no locks, no formatting)
+   Text form : 13 lowercase base-36 digits, produced only on request
+
+   Layout (uint64):
+     bit 63 = 0  → native id, bits 0..62 = counter value
+     bit 63 = 1  → foreign id, bits 0..31 = index into a caller-owned
+                   SymbolTable (ids from the JS store.js exports, e.g.
+                   "mgt4k2x9b7qz1a" — 14 chars, more than 63 bits hold)
+
+   Foreign ids are interned into the registry passed to parse(), so they
+   live exactly as long as the deck or import that owns it. Every string
+   maps to exactly one QuestionId and back:
+   parse(s, reg).toString(reg) == s for any s.
+
+   Question::id and the question maps still key on the text form —
+   generateId() formats each new id immediately. QuestionId is the
+   compact form for code that keeps ids outside a Question.
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef QUESTION_ID_H
+#define QUESTION_ID_H
+
+#include "symbol_table.h"
+#include <string>
+#include <string_view>
+#include <atomic>
+#include <ctime>
+#include <cstdint>
+#include <functional>
+
+using namespace std;
+
+namespace dsa {
+
+struct QuestionId {
+    static constexpr uint64_t FOREIGN_BIT = 1ULL << 63;
+    static constexpr int      TEXT_LEN    = 13;      // 36^13 > 2^63
+    static constexpr uint64_t BLOCK_SIZE  = 4096;    // ids reserved per thread refill
+
+    uint64_t value;
+
+    constexpr QuestionId() : value(0) {}
+    constexpr explicit QuestionId(uint64_t v) : value(v) {}
+
+    // ── Generate — thread-local fast path, one fetch_add per block ──
+    static QuestionId next() {
+        struct Block { uint64_t next = 0, end = 0; };
+        thread_local Block blk;
+        if (blk.next == blk.end) {
+            uint64_t start = counter().fetch_add(BLOCK_SIZE, memory_order_relaxed);
+            blk.next = start;
+            blk.end  = start + BLOCK_SIZE;
+        }
+        return QuestionId(blk.next++);
+    }
+
+    // ── Parse — native 13-digit base-36 text, otherwise registered in `foreign` ──
+    static QuestionId parse(string_view s, SymbolTable& foreign) {
+        QuestionId id;
+        if (parseNative(s, id)) return id;
+        return QuestionId(FOREIGN_BIT | foreign.intern(s));
+    }
+
+    // native text only — no registry needed, false for anything else
+    static bool parseNative(string_view s, QuestionId& out) {
+        uint64_t v;
+        if (!decodeNative(s, v)) return false;
+        out = QuestionId(v);
+        return true;
+    }
+
+    bool     isNative() const { return (value & FOREIGN_BIT) == 0; }
+    uint32_t foreignIndex() const { return static_cast<uint32_t>(value); }
+
+    // ── Format — only when text is actually needed ──
+    string toString(const SymbolTable& foreign) const {
+        return isNative() ? toString() : foreign.str(foreignIndex());
+    }
+
+    string toString() const {
+        if (!isNative())
+            throw logic_error("QuestionId::toString() — foreign id needs its registry!");
+        char buf[TEXT_LEN];
+        uint64_t v = value;
+        for (int i = TEXT_LEN - 1; i >= 0; --i) {
+            buf[i] = "0123456789abcdefghijklmnopqrstuvwxyz"[v % 36];
+            v /= 36;
+        }
+        return string(buf, TEXT_LEN);
+    }
+
+    // splitmix64 finalizer — spreads sequential counters across buckets
+    size_t hash() const {
+        uint64_t x = value;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return static_cast<size_t>(x ^ (x >> 31));
+    }
+
+    bool operator==(QuestionId o) const { return value == o.value; }
+    bool operator!=(QuestionId o) const { return value != o.value; }
+    bool operator< (QuestionId o) const { return value <  o.value; }
+
+private:
+    // seeded from the wall clock so ids from separate runs do not
+    // overlap (2^24 ids per second of start time)
+    static atomic<uint64_t>& counter() {
+        static atomic<uint64_t> c(static_cast<uint64_t>(time(nullptr)) << 24);
+        return c;
+    }
+
+    static bool decodeNative(string_view s, uint64_t& out) {
+        if (s.size() != static_cast<size_t>(TEXT_LEN)) return false;
+        uint64_t v = 0;
+        for (char ch : s) {
+            uint64_t d;
+            if (ch >= '0' && ch <= '9')      d = static_cast<uint64_t>(ch - '0');
+            else if (ch >= 'a' && ch <= 'z') d = static_cast<uint64_t>(ch - 'a') + 10;
+            else return false;
+            if (v > (FOREIGN_BIT - 1 - d) / 36) return false;   // would reach bit 63
+            v = v * 36 + d;
+        }
+        out = v;
+        return true;
+    }
+};
+
+inline ostream& operator<<(ostream& os, QuestionId id) {
+    if (!id.isNative()) return os << "foreign#" << id.foreignIndex();
+    return os << id.toString();
+}
+
+} // namespace dsa
+
+namespace std {
+template <> struct hash<dsa::QuestionId> {
+    size_t operator()(dsa::QuestionId id) const { return id.hash(); }
+};
+} // namespace std
+
+#endif // QUESTION_ID_H
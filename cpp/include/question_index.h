@@ -0,0 +1,265 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Secondary Indexes (posting lists)
+
+   One posting list per attribute value — subject, platform,
+   difficulty, status, and every tag — holding the slots of the
+   questions that carry it. Each slot remembers where it sits in
+   every list, so add / remove / update are O(1 + tags) (swap-remove,
+   no list scans).
+
+   A query walks the shortest posting list among its predicates and
+   checks the rest on the question itself, so "Hard + NEEDS_REVISION
+   + Graphs" costs O(smallest matching list), not O(deck).
+
+   Owned by QuestionHashMap (enableIndexes()); works on any container
+   whose Question objects keep their addresses.
+
+   Edits: update(slot) re-files at once. markDirty(slot) defers it to
+   the next query, which sees the question as it is at that moment —
+   later edits need another markDirty / update. Queries may run
+   concurrently with each other (the deferred re-filing is done once,
+   under a lock); add / remove / update / markDirty may not.
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef QUESTION_INDEX_H
+#define QUESTION_INDEX_H
+
+#include "dsa_core.h"
+#include <atomic>
+#include <mutex>
+#include <optional>
+
+using namespace std;
+
+namespace dsa {
+
+// ── Conjunctive query — unset fields match everything ──
+
+struct IndexQuery {
+    optional<Difficulty>     difficulty;
+    optional<QuestionStatus> status;
+    optional<Symbol>         subject;
+    optional<Symbol>         platform;
+    optional<Symbol>         tag;
+
+    IndexQuery& withDifficulty(Difficulty d)   { difficulty = d; return *this; }
+    IndexQuery& withStatus(QuestionStatus s)   { status = s; return *this; }
+    IndexQuery& withSubject(string_view s)     { subject = Symbol::find(s); return *this; }
+    IndexQuery& withPlatform(string_view p)    { platform = Symbol::find(p); return *this; }
+    IndexQuery& withTag(string_view t)         { tag = Symbol::find(t); return *this; }
+
+    bool matches(const Question& q) const {
+        if (difficulty && q.difficulty != *difficulty) return false;
+        if (status     && q.status     != *status)     return false;
+        // an unknown name (invalid symbol) matches nothing
+        if (subject  && (!subject->valid()  || q.subject  != *subject))  return false;
+        if (platform && (!platform->valid() || q.platform != *platform)) return false;
+        if (tag) {
+            if (!tag->valid()) return false;
+            for (Symbol t : q.tags)
+                if (t == *tag) return true;
+            return false;
+        }
+        return true;
+    }
+};
+
+// ── Index ──
+
+class QuestionIndex {
+public:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+private:
+    enum Field { SUBJECT, PLATFORM, DIFFICULTY, STATUS, FIELDS };
+
+    struct TagPosting { uint32_t tag, pos; };
+
+    struct Slot {
+        const Question*    q;
+        uint32_t           key[FIELDS];
+        uint32_t           pos[FIELDS];
+        vector<TagPosting> tags;
+        bool               dirty;
+    };
+
+    using PostingList = vector<uint32_t>;
+
+    vector<Slot>        slots_;
+    vector<uint32_t>    free_;
+    vector<uint32_t>    dirty_;
+    vector<PostingList> fields_[FIELDS];    // field → key → slots
+    vector<PostingList> tagLists_;          // tag symbol id → slots
+    size_t              live_ = 0;
+    atomic<bool>        pending_{false};    // dirty_ is non-empty
+    mutex               flushMu_;
+
+    static const PostingList& emptyList() {
+        static const PostingList none;
+        return none;
+    }
+
+    static uint32_t keyOf(const Question& q, int f) {
+        switch (f) {
+            case SUBJECT:    return q.subject.id;
+            case PLATFORM:   return q.platform.id;
+            case DIFFICULTY: return static_cast<uint32_t>(q.difficulty);
+            default:         return static_cast<uint32_t>(q.status);
+        }
+    }
+
+    static uint32_t append(vector<PostingList>& lists, uint32_t key, uint32_t slot) {
+        if (key >= lists.size()) lists.resize(key + 1);
+        lists[key].push_back(slot);
+        return static_cast<uint32_t>(lists[key].size() - 1);
+    }
+
+    // swap-remove; returns the slot moved into `pos`, or NONE
+    static uint32_t erase(vector<PostingList>& lists, uint32_t key, uint32_t pos) {
+        PostingList& l = lists[key];
+        uint32_t moved = l.back();
+        l[pos] = moved;
+        l.pop_back();
+        return pos < l.size() ? moved : NONE;
+    }
+
+    void link(uint32_t s) {
+        Slot& sl = slots_[s];
+        for (int f = 0; f < FIELDS; ++f) {
+            sl.key[f] = keyOf(*sl.q, f);
+            sl.pos[f] = sl.key[f] == SymbolTable::NONE ? NONE : append(fields_[f], sl.key[f], s);
+        }
+        sl.tags.clear();
+        for (Symbol t : sl.q->tags) {
+            if (!t.valid()) continue;
+            bool dup = false;
+            for (const auto& tp : sl.tags) if (tp.tag == t.id) { dup = true; break; }
+            if (!dup) sl.tags.push_back({t.id, append(tagLists_, t.id, s)});
+        }
+    }
+
+    void unlink(uint32_t s) {
+        Slot& sl = slots_[s];
+        for (int f = 0; f < FIELDS; ++f) {
+            if (sl.pos[f] == NONE) continue;
+            uint32_t moved = erase(fields_[f], sl.key[f], sl.pos[f]);
+            if (moved != NONE) slots_[moved].pos[f] = sl.pos[f];
+        }
+        for (const auto& tp : sl.tags) {
+            uint32_t moved = erase(tagLists_, tp.tag, tp.pos);
+            if (moved == NONE) continue;
+            for (auto& m : slots_[moved].tags)
+                if (m.tag == tp.tag) { m.pos = tp.pos; break; }
+        }
+        sl.tags.clear();
+    }
+
+    const PostingList& list(const vector<PostingList>& lists, uint32_t key) const {
+        return key < lists.size() ? lists[key] : emptyList();
+    }
+
+    // shortest posting list the query pins down; nullptr = no indexed predicate
+    const PostingList* narrowest(const IndexQuery& iq) const {
+        const PostingList* best = nullptr;
+        auto consider = [&](const PostingList& l) {
+            if (!best || l.size() < best->size()) best = &l;
+        };
+        if (iq.difficulty) consider(list(fields_[DIFFICULTY], static_cast<uint32_t>(*iq.difficulty)));
+        if (iq.status)     consider(list(fields_[STATUS], static_cast<uint32_t>(*iq.status)));
+        if (iq.subject)    consider(list(fields_[SUBJECT], iq.subject->id));
+        if (iq.platform)   consider(list(fields_[PLATFORM], iq.platform->id));
+        if (iq.tag)        consider(list(tagLists_, iq.tag->id));
+        return best;
+    }
+
+public:
+    // ── Maintenance — O(1 + tags) ──
+    uint32_t add(const Question* q) {
+        uint32_t s;
+        if (!free_.empty()) { s = free_.back(); free_.pop_back(); }
+        else {
+            if (slots_.size() >= NONE) throw length_error("QuestionIndex::add() — too many questions!");
+            s = static_cast<uint32_t>(slots_.size());
+            slots_.emplace_back();
+        }
+        slots_[s].q = q;
+        slots_[s].dirty = false;
+        link(s);
+        live_++;
+        return s;
+    }
+
+    void remove(uint32_t s) {
+        unlink(s);
+        slots_[s].q = nullptr;
+        slots_[s].dirty = false;     // a stale dirty_ entry is skipped in flush()
+        free_.push_back(s);
+        live_--;
+    }
+
+    // re-file a question whose attributes may have changed
+    void update(uint32_t s) {
+        unlink(s);
+        link(s);
+        slots_[s].dirty = false;
+    }
+
+    // deferred update — the caller handed out a mutable reference
+    void markDirty(uint32_t s) {
+        if (slots_[s].dirty) return;
+        slots_[s].dirty = true;
+        dirty_.push_back(s);
+        pending_.store(true, memory_order_relaxed);
+    }
+
+    // safe from concurrent queries: the first one re-files, the rest wait
+    void flush() {
+        if (!pending_.load(memory_order_acquire)) return;
+        lock_guard<mutex> lk(flushMu_);
+        if (!pending_.load(memory_order_relaxed)) return;
+        for (uint32_t s : dirty_)
+            if (slots_[s].dirty) update(s);
+        dirty_.clear();
+        pending_.store(false, memory_order_release);
+    }
+
+    void clear() {
+        slots_.clear(); free_.clear(); dirty_.clear(); tagLists_.clear();
+        for (auto& f : fields_) f.clear();
+        live_ = 0;
+        pending_.store(false, memory_order_relaxed);
+    }
+
+    // ── Queries — O(narrowest posting list) ──
+    template <typename Fn>
+    void forEach(const IndexQuery& iq, Fn&& fn) {
+        flush();
+        const PostingList* l = narrowest(iq);
+        if (l) {
+            for (uint32_t s : *l)
+                if (iq.matches(*slots_[s].q)) fn(*slots_[s].q);
+        } else {
+            for (const auto& sl : slots_)
+                if (sl.q && iq.matches(*sl.q)) fn(*sl.q);
+        }
+    }
+
+    vector<const Question*> query(const IndexQuery& iq) {
+        vector<const Question*> out;
+        forEach(iq, [&](const Question& q) { out.push_back(&q); });
+        return out;
+    }
+
+    size_t count(const IndexQuery& iq) {
+        size_t n = 0;
+        forEach(iq, [&](const Question&) { ++n; });
+        return n;
+    }
+
+    size_t size() const { return live_; }
+    size_t pendingUpdates() const { return dirty_.size(); }
+};
+
+} // namespace dsa
+
+#endif // QUESTION_INDEX_H
@@ -0,0 +1,264 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Columnar Question Table (Struct-of-Arrays)
+
+   Data Layout : one contiguous column per field
+
+   Hot columns (difficulty, status, easeFactor, revisionCycle, streak,
+   xpEarned, dueDay) are packed arrays, so scans that only look at one
+   or two fields stream through memory instead of dragging whole
+   Question structs (strings, tag vectors) through the cache.
+
+   Time:  Append → O(1) amortized  |  Row access → O(1)
+          Column scan → O(n), sequential
+   Space: O(n)
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef QUESTION_TABLE_H
+#define QUESTION_TABLE_H
+
+#include "dsa_core.h"
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+
+namespace dsa {
+
+class QuestionTable {
+public:
+    using RowId = uint32_t;
+
+    // ── Row View — read-only Question-shaped access to one row ──
+
+    class Row {
+    private:
+        const QuestionTable* table_;
+        RowId                row_;
+
+    public:
+        Row(const QuestionTable* t, RowId r) : table_(t), row_(r) {}
+
+        RowId index() const { return row_; }
+
+        const string&         id()           const { return table_->id_[row_]; }
+        const string&         name()         const { return table_->name_[row_]; }
+        Symbol                subject()      const { return table_->subject_[row_]; }
+        Symbol                platform()     const { return table_->platform_[row_]; }
+        Difficulty            difficulty()   const { return static_cast<Difficulty>(table_->difficulty_[row_]); }
+        QuestionStatus        status()       const { return static_cast<QuestionStatus>(table_->status_[row_]); }
+        double                easeFactor()   const { return table_->easeFactor_[row_]; }
+        int                   revisionCycle() const { return table_->revisionCycle_[row_]; }
+        int                   streak()       const { return table_->streak_[row_]; }
+        int                   xpEarned()     const { return table_->xpEarned_[row_]; }
+        EpochDay              dateSolved()   const { return EpochDay(table_->dateSolved_[row_]); }
+        EpochDay              nextRevisionDate() const { return EpochDay(table_->dueDay_[row_]); }
+        EpochDay              lastRevisionDate() const { return EpochDay(table_->lastRevision_[row_]); }
+        const SymbolList&     tags()         const { return table_->tags_[row_]; }
+        const string&         notes()        const { return table_->notes_[row_]; }
+
+        double getPriorityScore(EpochDay today) const {
+            return table_->priorityScore(row_, today);
+        }
+
+        Question toQuestion() const { return table_->get(row_); }
+    };
+
+private:
+    // hot columns
+    vector<uint8_t>  difficulty_;
+    vector<uint8_t>  status_;
+    vector<double>   easeFactor_;
+    vector<int32_t>  revisionCycle_;
+    vector<int32_t>  streak_;
+    vector<int32_t>  xpEarned_;
+    vector<int32_t>  dueDay_;         // EpochDay::days of nextRevisionDate
+
+    // cold columns
+    vector<string>          id_;
+    vector<string>          name_;
+    vector<Symbol>          subject_;
+    vector<Symbol>          platform_;
+    vector<int32_t>         dateSolved_;
+    vector<int32_t>         lastRevision_;
+    vector<SymbolList>      tags_;
+    vector<string>          notes_;
+
+public:
+    QuestionTable() = default;
+
+    explicit QuestionTable(const vector<Question>& questions) {
+        reserve(questions.size());
+        for (const auto& q : questions) push_back(q);
+    }
+
+    void reserve(size_t n) {
+        difficulty_.reserve(n);  status_.reserve(n);    easeFactor_.reserve(n);
+        revisionCycle_.reserve(n); streak_.reserve(n);  xpEarned_.reserve(n);
+        dueDay_.reserve(n);      id_.reserve(n);        name_.reserve(n);
+        subject_.reserve(n);     platform_.reserve(n);  dateSolved_.reserve(n);
+        lastRevision_.reserve(n); tags_.reserve(n);     notes_.reserve(n);
+    }
+
+    // ── Append / Update — O(1) amortized ──
+
+    RowId push_back(const Question& q) {
+        RowId r = static_cast<RowId>(id_.size());
+        difficulty_.push_back(static_cast<uint8_t>(q.difficulty));
+        status_.push_back(static_cast<uint8_t>(q.status));
+        easeFactor_.push_back(q.easeFactor);
+        revisionCycle_.push_back(q.revisionCycle);
+        streak_.push_back(q.streak);
+        xpEarned_.push_back(q.xpEarned);
+        dueDay_.push_back(q.nextRevisionDate.days);
+        id_.push_back(q.id);
+        name_.push_back(q.name);
+        subject_.push_back(q.subject);
+        platform_.push_back(q.platform);
+        dateSolved_.push_back(q.dateSolved.days);
+        lastRevision_.push_back(q.lastRevisionDate.days);
+        tags_.push_back(q.tags);
+        notes_.push_back(q.notes);
+        return r;
+    }
+
+    void set(RowId r, const Question& q) {
+        difficulty_[r]    = static_cast<uint8_t>(q.difficulty);
+        status_[r]        = static_cast<uint8_t>(q.status);
+        easeFactor_[r]    = q.easeFactor;
+        revisionCycle_[r] = q.revisionCycle;
+        streak_[r]        = q.streak;
+        xpEarned_[r]      = q.xpEarned;
+        dueDay_[r]        = q.nextRevisionDate.days;
+        id_[r]            = q.id;
+        name_[r]          = q.name;
+        subject_[r]       = q.subject;
+        platform_[r]      = q.platform;
+        dateSolved_[r]    = q.dateSolved.days;
+        lastRevision_[r]  = q.lastRevisionDate.days;
+        tags_[r]          = q.tags;
+        notes_[r]         = q.notes;
+    }
+
+    // materialize one row back into a Question
+    Question get(RowId r) const {
+        Question q;
+        q.id               = id_[r];
+        q.name             = name_[r];
+        q.subject          = subject_[r];
+        q.platform         = platform_[r];
+        q.difficulty       = static_cast<Difficulty>(difficulty_[r]);
+        q.status           = static_cast<QuestionStatus>(status_[r]);
+        q.easeFactor       = easeFactor_[r];
+        q.revisionCycle    = revisionCycle_[r];
+        q.streak           = streak_[r];
+        q.xpEarned         = xpEarned_[r];
+        q.dateSolved       = EpochDay(dateSolved_[r]);
+        q.nextRevisionDate = EpochDay(dueDay_[r]);
+        q.lastRevisionDate = EpochDay(lastRevision_[r]);
+        q.tags             = tags_[r];
+        q.notes            = notes_[r];
+        return q;
+    }
+
+    vector<Question> toQuestions() const {
+        vector<Question> out;
+        out.reserve(size());
+        for (RowId r = 0; r < size(); ++r) out.push_back(get(r));
+        return out;
+    }
+
+    Row row(RowId r) const { return Row(this, r); }
+    Row operator[](RowId r) const { return Row(this, r); }
+
+    RowId size()  const { return static_cast<RowId>(id_.size()); }
+    bool  empty() const { return id_.empty(); }
+
+    // ── Column Access ──
+
+    const vector<uint8_t>& difficultyColumn()    const { return difficulty_; }
+    const vector<uint8_t>& statusColumn()        const { return status_; }
+    const vector<double>&  easeFactorColumn()    const { return easeFactor_; }
+    const vector<int32_t>& revisionCycleColumn() const { return revisionCycle_; }
+    const vector<int32_t>& streakColumn()        const { return streak_; }
+    const vector<int32_t>& xpEarnedColumn()      const { return xpEarned_; }
+    const vector<int32_t>& dueDayColumn()        const { return dueDay_; }
+    const vector<Symbol>&  subjectColumn()       const { return subject_; }
+
+    // same formula as Question::getPriorityScore, read from columns
+    double priorityScore(RowId r, EpochDay today) const {
+        if (dueDay_[r] == EpochDay::NONE || today.empty() ||
+            status_[r] == static_cast<uint8_t>(QuestionStatus::MASTERED))
+            return -1.0;
+        Difficulty d     = static_cast<Difficulty>(difficulty_[r]);
+        double priority  = static_cast<double>(today.days - dueDay_[r]);
+        double diffMult  = (d == Difficulty::HARD)   ? 1.5
+                         : (d == Difficulty::MEDIUM) ? 1.2 : 1.0;
+        double easePen   = (2.5 - easeFactor_[r]) * 2.0;
+        double streakPen = (streak_[r] < 3) ? 1.5 : 1.0;
+        return (priority * diffMult + easePen) * streakPen;
+    }
+
+    // ── Column Scans — branch-free compaction into row-id lists ──
+
+    vector<RowId> rowsWithDifficulty(Difficulty d) const {
+        return selectEq(difficulty_, static_cast<uint8_t>(d));
+    }
+
+    vector<RowId> rowsWithStatus(QuestionStatus s) const {
+        return selectEq(status_, static_cast<uint8_t>(s));
+    }
+
+    // non-mastered rows whose due day lies in [from, to]
+    vector<RowId> rowsDueBetween(EpochDay from, EpochDay to) const {
+        const RowId    n        = size();
+        const int32_t* due      = dueDay_.data();
+        const uint8_t* st       = status_.data();
+        const uint8_t  mastered = static_cast<uint8_t>(QuestionStatus::MASTERED);
+        // NONE is INT32_MIN, so it always fails the lower bound below
+        // as long as `from` is a real day
+        int32_t lo = from.empty() ? EpochDay::NONE + 1 : from.days;
+        int32_t hi = to.days;
+
+        vector<RowId> out(n);
+        RowId k = 0;
+        for (RowId i = 0; i < n; ++i) {
+            out[k] = i;
+            k += static_cast<RowId>((due[i] >= lo) & (due[i] <= hi) & (st[i] != mastered));
+        }
+        out.resize(k);
+        return out;
+    }
+
+    vector<RowId> rowsDueBy(EpochDay day) const {
+        return rowsDueBetween(EpochDay(), day);
+    }
+
+    void print() const {
+        cout << "\n╔══════════════════════════════════════════╗\n"
+             << "║    QUESTION TABLE (Columnar / SoA)       ║\n"
+             << "╠══════════════════════════════════════════╣\n"
+             << "║ Rows: " << size() << "\n"
+             << "║ Hot bytes / row: "
+             << (sizeof(uint8_t) * 2 + sizeof(double) + sizeof(int32_t) * 4) << "\n"
+             << "╚══════════════════════════════════════════╝\n";
+    }
+
+private:
+    template <typename T>
+    static vector<RowId> selectEq(const vector<T>& col, T value) {
+        const RowId n = static_cast<RowId>(col.size());
+        const T*    c = col.data();
+        vector<RowId> out(n);
+        RowId k = 0;
+        for (RowId i = 0; i < n; ++i) {
+            out[k] = i;
+            k += static_cast<RowId>(c[i] == value);
+        }
+        out.resize(k);
+        return out;
+    }
+};
+
+} // namespace dsa
+
+#endif // QUESTION_TABLE_H
@@ -1,215 +1,410 @@
 /* ═══════════════════════════════════════════════════════════════════
    DSA Tracker — Trie (Prefix Tree) for Question Search & Autocomplete
-   
+
+   Layout: compressed (radix / Patricia) trie in flat arrays
+     • single-child chains are merged into one edge; labels are
+       (offset, length) slices of one shared character pool
+     • nodes are 24-byte structs addressed by uint32 index — first
+       child / next sibling, siblings kept sorted by lead character,
+       so autocomplete walks them in order without sorting
+     • question ids live in a side array, referenced only by nodes
+       that end a word
+
+   Removal merges edges back together; label bytes of removed words
+   stay in the pool until the trie is destroyed.
+
    Time:  Insert / Search → O(L)  |  Autocomplete → O(L + K)
-   Space: O(N × L)
+   Space: O(N) nodes (≤ 2 per word) + O(total distinct suffix length)
    ═══════════════════════════════════════════════════════════════════ */
 
 #ifndef QUESTION_TRIE_H
 #define QUESTION_TRIE_H
 
 #include "dsa_core.h"
-#include <unordered_map>
-#include <memory>
-#include <queue>
+#include "metrics.h"
+#include <cstring>
+#include <memory_resource>
 
 using namespace std;
 
 namespace dsa {
 
-struct TrieNode {
-    unordered_map<char, unique_ptr<TrieNode>> children;
-    bool   isEndOfWord;
-    string questionId;
-    int    prefixCount;
-
-    TrieNode() : isEndOfWord(false), prefixCount(0) {}
-};
-
 class QuestionTrie {
 private:
-    unique_ptr<TrieNode> root_;
+    static constexpr uint32_t NIL       = UINT32_MAX;
+    static constexpr uint32_t ROOT      = 0;
+    static constexpr size_t   MAX_LABEL = UINT16_MAX;    // longer suffixes become a chain
+
+    struct Node {
+        uint32_t label;       // edge label = pool_[label, label + len)
+        uint16_t len;
+        char     lead;        // pool_[label], kept here for sibling scans
+        uint32_t child;       // first child (lowest lead)
+        uint32_t sibling;     // next sibling (higher lead)
+        uint32_t count;       // inserts passing through — countWithPrefix()
+        uint32_t word;        // index into words_ if a word ends here
+    };
+
+    struct Word {
+        uint32_t id;          // qid = idPool_[id, id + idLen)
+        uint32_t idLen;
+        uint32_t hits;        // times this word was inserted
+    };
+
+    pmr::vector<Node>     nodes_;
+    pmr::vector<Word>     words_;
+    pmr::string           pool_;
+    pmr::string           idPool_;
+    pmr::vector<uint32_t> freeNodes_;
+    pmr::vector<uint32_t> freeWords_;
+    uint32_t lastId_;             // offset of the most recently stored id
     int totalWords_;
 
     static string toLower(const string& s) {
         string r = s;
-        transform(r.begin(), r.end(), r.begin(), ::tolower);
+        transform(r.begin(), r.end(), r.begin(),
+                  [](unsigned char c) { return static_cast<char>(tolower(c)); });
         return r;
     }
 
-    void collectWords(TrieNode* node, const string& prefix,
-                      vector<string>& results, int maxResults) const {
-        if (!node || static_cast<int>(results.size()) >= maxResults) return;
-        if (node->isEndOfWord) results.push_back(prefix);
-
-        vector<pair<char, TrieNode*>> sorted;
-        for (auto& kv : node->children)
-            sorted.emplace_back(kv.first, kv.second.get());
-        sort(sorted.begin(), sorted.end());
-
-        for (auto& sc : sorted)
-            collectWords(sc.second, prefix + sc.first, results, maxResults);
-    }
-
-    void fuzzyHelper(TrieNode* node, const string& target,
-                     const string& current, vector<int>& prevRow,
-                     vector<pair<string, int>>& results, int maxDist) const {
-        int cols = static_cast<int>(target.size()) + 1;
-        if (node->isEndOfWord && prevRow[cols - 1] <= maxDist)
-            results.emplace_back(current, prevRow[cols - 1]);
-
-        for (auto& kv : node->children) {
-            char ch = kv.first;
-            TrieNode* child = kv.second.get();
-            vector<int> row(cols);
-            row[0] = prevRow[0] + 1;
-            for (int j = 1; j < cols; ++j) {
-                int ins = row[j-1] + 1;
-                int del = prevRow[j] + 1;
-                int rep = prevRow[j-1] + (target[j-1] != ch ? 1 : 0);
-                row[j] = min({ins, del, rep});
-            }
-            if (*min_element(row.begin(), row.end()) <= maxDist)
-                fuzzyHelper(child, target, current + ch, row, results, maxDist);
+    uint32_t newNode(uint32_t label, size_t len) {
+        uint32_t i;
+        if (!freeNodes_.empty()) { i = freeNodes_.back(); freeNodes_.pop_back(); }
+        else { i = static_cast<uint32_t>(nodes_.size()); nodes_.emplace_back(); }
+        nodes_[i] = Node{label, static_cast<uint16_t>(len), len ? pool_[label] : '\0',
+                         NIL, NIL, 0, NIL};
+        return i;
+    }
+
+    void freeNode(uint32_t i) { freeNodes_.push_back(i); }
+
+    uint32_t newWord(const string& qid) {
+        // insertQuestion() indexes several words under one id — share its bytes
+        uint32_t len = static_cast<uint32_t>(qid.size());
+        bool same = len && lastId_ + len == idPool_.size()
+                 && idPool_.compare(lastId_, len, qid.data(), len) == 0;
+        if (!same) { lastId_ = static_cast<uint32_t>(idPool_.size()); idPool_.append(qid.data(), len); }
+        Word w{lastId_, len, 1};
+        if (!freeWords_.empty()) {
+            uint32_t i = freeWords_.back();
+            freeWords_.pop_back();
+            words_[i] = w;
+            return i;
+        }
+        words_.push_back(w);
+        return static_cast<uint32_t>(words_.size() - 1);
+    }
+
+    // child of p whose edge starts with ch, NIL if none
+    uint32_t findChild(uint32_t p, char ch) const {
+        for (uint32_t c = nodes_[p].child; c != NIL; c = nodes_[c].sibling) {
+            if (nodes_[c].lead == ch) return c;
+            if (nodes_[c].lead > ch) break;
         }
+        return NIL;
+    }
+
+    // hooks c under p, keeping siblings sorted by lead
+    void linkChild(uint32_t p, uint32_t c) {
+        char ch = nodes_[c].lead;
+        uint32_t* link = &nodes_[p].child;
+        while (*link != NIL && nodes_[*link].lead < ch) link = &nodes_[*link].sibling;
+        nodes_[c].sibling = *link;
+        *link = c;
+    }
+
+    void unlinkChild(uint32_t p, uint32_t c) {
+        uint32_t* link = &nodes_[p].child;
+        while (*link != c) link = &nodes_[*link].sibling;
+        *link = nodes_[c].sibling;
+    }
+
+    // Cuts c's edge after m chars; the tail becomes c's only child and
+    // takes over c's children and word.
+    void split(uint32_t c, size_t m) {
+        uint32_t d = newNode(nodes_[c].label + static_cast<uint32_t>(m), nodes_[c].len - m);
+        Node& n = nodes_[c];
+        nodes_[d].child = n.child;
+        nodes_[d].count = n.count;
+        nodes_[d].word  = n.word;
+        n.len   = static_cast<uint16_t>(m);
+        n.child = d;
+        n.word  = NIL;
     }
 
-    bool removeHelper(TrieNode* node, const string& word, int depth) {
-        if (!node) return false;
-        if (depth == static_cast<int>(word.size())) {
-            if (!node->isEndOfWord) return false;
-            node->isEndOfWord = false;
-            totalWords_--;
-            return node->children.empty();
+    // Folds p's only child into p (p ends no word)
+    void mergeOnlyChild(uint32_t p) {
+        uint32_t c = nodes_[p].child;
+        size_t len = size_t(nodes_[p].len) + nodes_[c].len;
+        if (len > MAX_LABEL) return;
+        if (nodes_[p].label + nodes_[p].len != nodes_[c].label) {
+            uint32_t at = static_cast<uint32_t>(pool_.size());
+            pool_.append(pool_, nodes_[p].label, nodes_[p].len);
+            pool_.append(pool_, nodes_[c].label, nodes_[c].len);
+            nodes_[p].label = at;
+        }
+        nodes_[p].len   = static_cast<uint16_t>(len);
+        nodes_[p].child = nodes_[c].child;
+        nodes_[p].word  = nodes_[c].word;
+        freeNode(c);
+    }
+
+    // Follows s from the root. On success the walk ends on the edge into
+    // `at`, with `rest` of that edge's chars unmatched (0 = exactly at `at`).
+    bool walk(const string& s, uint32_t& at, size_t& rest, size_t& visited) const {
+        uint32_t cur = ROOT;
+        size_t i = 0;
+        while (i < s.size()) {
+            ++visited;
+            uint32_t c = findChild(cur, s[i]);
+            if (c == NIL) return false;
+            const Node& n = nodes_[c];
+            size_t m = min<size_t>(n.len, s.size() - i);
+            if (memcmp(pool_.data() + n.label, s.data() + i, m) != 0) return false;
+            i  += m;
+            cur = c;
+            if (m < n.len) { at = c; rest = n.len - m; return true; }
+        }
+        at = cur;
+        rest = 0;
+        return true;
+    }
+
+    void collectWords(uint32_t node, string& prefix,
+                      vector<string>& results, int maxResults, size_t& visited) const {
+        if (static_cast<int>(results.size()) >= maxResults) return;
+        ++visited;
+        if (nodes_[node].word != NIL) results.push_back(prefix);
+
+        for (uint32_t c = nodes_[node].child;
+             c != NIL && static_cast<int>(results.size()) < maxResults; c = nodes_[c].sibling) {
+            prefix.append(pool_.data() + nodes_[c].label, nodes_[c].len);
+            collectWords(c, prefix, results, maxResults, visited);
+            prefix.resize(prefix.size() - nodes_[c].len);
         }
-        char ch = word[depth];
-        auto it = node->children.find(ch);
-        if (it == node->children.end()) return false;
-        if (removeHelper(it->second.get(), word, depth + 1)) {
-            node->children.erase(ch);
-            return !node->isEndOfWord && node->children.empty();
+    }
+
+    // rows holds one Levenshtein row per char of `current` (plus row 0);
+    // the last row belongs to `node`
+    void fuzzyHelper(uint32_t node, const string& target,
+                     string& current, vector<int>& rows,
+                     vector<pair<string, int>>& results, int maxDist, size_t& visited) const {
+        ++visited;
+        size_t cols = target.size() + 1;
+        int dist = rows[current.size() * cols + cols - 1];
+        if (node != ROOT && nodes_[node].word != NIL && dist <= maxDist)
+            results.emplace_back(current, dist);
+
+        for (uint32_t c = nodes_[node].child; c != NIL; c = nodes_[c].sibling) {
+            size_t base = current.size();
+            bool alive = true;
+            for (size_t k = 0; k < nodes_[c].len && alive; ++k) {
+                char ch = pool_[nodes_[c].label + k];
+                current.push_back(ch);
+                rows.resize((current.size() + 1) * cols);
+                const int* prev = &rows[(current.size() - 1) * cols];
+                int*       row  = &rows[current.size() * cols];
+                row[0] = prev[0] + 1;
+                int best = row[0];
+                for (size_t j = 1; j < cols; ++j) {
+                    int ins = row[j-1] + 1;
+                    int del = prev[j] + 1;
+                    int rep = prev[j-1] + (target[j-1] != ch ? 1 : 0);
+                    row[j] = min({ins, del, rep});
+                    best = min(best, row[j]);
+                }
+                alive = best <= maxDist;
+            }
+            if (alive) fuzzyHelper(c, target, current, rows, results, maxDist, visited);
+            current.resize(base);
         }
-        return false;
     }
 
 public:
-    QuestionTrie() : root_(make_unique<TrieNode>()), totalWords_(0) {}
+    explicit QuestionTrie(pmr::memory_resource* mr = pmr::get_default_resource())
+        : nodes_(mr), words_(mr), pool_(mr), idPool_(mr),
+          freeNodes_(mr), freeWords_(mr), lastId_(0), totalWords_(0) { newNode(0, 0); }
+
+    QuestionTrie(const QuestionTrie&)            = delete;
+    QuestionTrie& operator=(const QuestionTrie&) = delete;
+
+    // o is left an empty trie with a fresh root (hence not noexcept)
+    QuestionTrie(QuestionTrie&& o)
+        : nodes_(move(o.nodes_)), words_(move(o.words_)),
+          pool_(move(o.pool_)), idPool_(move(o.idPool_)),
+          freeNodes_(move(o.freeNodes_)), freeWords_(move(o.freeWords_)),
+          lastId_(o.lastId_), totalWords_(o.totalWords_) {
+        o.nodes_.clear(); o.words_.clear(); o.pool_.clear(); o.idPool_.clear();
+        o.freeNodes_.clear(); o.freeWords_.clear();
+        o.lastId_ = 0;
+        o.totalWords_ = 0;
+        o.newNode(0, 0);
+    }
+
+    pmr::memory_resource* resource() const { return nodes_.get_allocator().resource(); }
 
     // Insert — O(L)
     void insert(const string& word, const string& qid = "") {
+        DSA_METRIC_ADD(TRIE_INSERT, 1);
         string low = toLower(word);
-        TrieNode* cur = root_.get();
-        for (char ch : low) {
-            cur->prefixCount++;
-            if (cur->children.find(ch) == cur->children.end())
-                cur->children[ch] = make_unique<TrieNode>();
-            cur = cur->children[ch].get();
+        uint32_t cur = ROOT;
+        nodes_[ROOT].count++;
+        size_t i = 0;
+        while (i < low.size()) {
+            uint32_t c = findChild(cur, low[i]);
+            if (c == NIL) {
+                // new suffix: one pool append, one node per MAX_LABEL chars
+                uint32_t at = static_cast<uint32_t>(pool_.size());
+                pool_.append(low.data() + i, low.size() - i);
+                for (size_t rem = low.size() - i; rem > 0; ) {
+                    size_t len = min(rem, MAX_LABEL);
+                    uint32_t n = newNode(at, len);
+                    nodes_[n].count = 1;
+                    linkChild(cur, n);
+                    cur  = n;
+                    at  += static_cast<uint32_t>(len);
+                    rem -= len;
+                }
+                break;
+            }
+            size_t m = 1;
+            const Node& n = nodes_[c];
+            while (m < n.len && i + m < low.size() && pool_[n.label + m] == low[i + m]) ++m;
+            if (m < n.len) split(c, m);
+            nodes_[c].count++;
+            cur = c;
+            i  += m;
         }
-        cur->prefixCount++;
-        if (!cur->isEndOfWord) {
-            cur->isEndOfWord = true;
-            cur->questionId  = qid;
+        if (nodes_[cur].word == NIL) {
+            uint32_t w = newWord(qid);
+            nodes_[cur].word = w;
             totalWords_++;
+        } else {
+            words_[nodes_[cur].word].hits++;
         }
     }
 
     void insertQuestion(const Question& q) {
         insert(q.name, q.id);
-        insert(q.subject, q.id);
-        for (const auto& tag : q.tags) insert(tag, q.id);
+        insert(q.subject.str(), q.id);
+        for (Symbol tag : q.tags) insert(tag.str(), q.id);
     }
 
     // Search — O(L)
     bool search(const string& word) const {
-        string low = toLower(word);
-        TrieNode* cur = root_.get();
-        for (char ch : low) {
-            auto it = cur->children.find(ch);
-            if (it == cur->children.end()) return false;
-            cur = it->second.get();
-        }
-        return cur->isEndOfWord;
+        uint32_t at;
+        size_t rest, visited = 0;
+        return walk(toLower(word), at, rest, visited) && rest == 0 && nodes_[at].word != NIL;
     }
 
     bool startsWith(const string& prefix) const {
-        string low = toLower(prefix);
-        TrieNode* cur = root_.get();
-        for (char ch : low) {
-            auto it = cur->children.find(ch);
-            if (it == cur->children.end()) return false;
-            cur = it->second.get();
-        }
-        return true;
+        uint32_t at;
+        size_t rest, visited = 0;
+        return walk(toLower(prefix), at, rest, visited);
     }
 
     // Autocomplete — O(L + K)
     vector<string> autocomplete(const string& prefix, int maxResults = 10) const {
+        DSA_METRIC_ADD(TRIE_AUTOCOMPLETE, 1);
+        DSA_METRIC_TIMER(TRIE_AUTOCOMPLETE_NS);
         string low = toLower(prefix);
-        TrieNode* cur = root_.get();
-        for (char ch : low) {
-            auto it = cur->children.find(ch);
-            if (it == cur->children.end()) return {};
-            cur = it->second.get();
-        }
+        uint32_t at;
+        size_t rest, visited = 0;
         vector<string> results;
-        collectWords(cur, low, results, maxResults);
+        if (walk(low, at, rest, visited)) {
+            const Node& n = nodes_[at];
+            low.append(pool_.data() + n.label + n.len - rest, rest);   // finish the edge
+            collectWords(at, low, results, maxResults, visited);
+        }
+        DSA_METRIC_ADD(TRIE_NODES_VISITED, visited);
+        DSA_METRIC_RECORD(TRIE_NODES_PER_QUERY, visited);
         return results;
     }
 
     int countWithPrefix(const string& prefix) const {
-        string low = toLower(prefix);
-        TrieNode* cur = root_.get();
-        for (char ch : low) {
-            auto it = cur->children.find(ch);
-            if (it == cur->children.end()) return 0;
-            cur = it->second.get();
-        }
-        return cur->prefixCount;
+        uint32_t at;
+        size_t rest, visited = 0;
+        if (!walk(toLower(prefix), at, rest, visited)) return 0;
+        return static_cast<int>(nodes_[at].count);
     }
 
-    // Fuzzy search — Levenshtein + trie pruning
+    // Fuzzy search — Levenshtein + trie pruning, one DP row per edge char
     vector<pair<string, int>> fuzzySearch(const string& target, int maxDist = 2) const {
+        DSA_METRIC_ADD(TRIE_FUZZY, 1);
+        DSA_METRIC_TIMER(TRIE_FUZZY_NS);
         string low = toLower(target);
+        size_t visited = 0;
         vector<pair<string, int>> results;
-        int cols = static_cast<int>(low.size()) + 1;
-        vector<int> firstRow(cols);
-        for (int i = 0; i < cols; ++i) firstRow[i] = i;
-
-        for (auto& kv : root_->children) {
-            char ch = kv.first;
-            TrieNode* child = kv.second.get();
-            vector<int> row(cols);
-            row[0] = 1;
-            for (int j = 1; j < cols; ++j) {
-                int ins = row[j-1] + 1, del = firstRow[j] + 1;
-                int rep = firstRow[j-1] + (low[j-1] != ch ? 1 : 0);
-                row[j] = min({ins, del, rep});
-            }
-            if (*min_element(row.begin(), row.end()) <= maxDist) {
-                string cur(1, ch);
-                fuzzyHelper(child, low, cur, row, results, maxDist);
-            }
-        }
+        vector<int> rows(low.size() + 1);
+        for (size_t i = 0; i < rows.size(); ++i) rows[i] = static_cast<int>(i);
+        string current;
+        fuzzyHelper(ROOT, low, current, rows, results, maxDist, visited);
+        DSA_METRIC_ADD(TRIE_NODES_VISITED, visited);
+        DSA_METRIC_RECORD(TRIE_NODES_PER_QUERY, visited);
 
-        sort(results.begin(), results.end(),
-             [](const pair<string,int>& a, const pair<string,int>& b) {
-                 return a.second < b.second;
-             });
+        // visited in sorted order, so ties stay alphabetical
+        stable_sort(results.begin(), results.end(),
+                    [](const pair<string,int>& a, const pair<string,int>& b) {
+                        return a.second < b.second;
+                    });
         return results;
     }
 
+    // true if the word was indexed; its inserts come off the prefix counts
     bool removeWord(const string& word) {
-        return removeHelper(root_.get(), toLower(word), 0);
+        string low = toLower(word);
+        vector<uint32_t> path{ROOT};
+        for (size_t i = 0; i < low.size(); ) {
+            uint32_t c = findChild(path.back(), low[i]);
+            if (c == NIL) return false;
+            const Node& n = nodes_[c];
+            if (n.len > low.size() - i ||
+                memcmp(pool_.data() + n.label, low.data() + i, n.len) != 0) return false;
+            i += n.len;
+            path.push_back(c);
+        }
+        uint32_t end = path.back();
+        uint32_t w   = nodes_[end].word;
+        if (w == NIL) return false;
+
+        for (uint32_t p : path) nodes_[p].count -= words_[w].hits;
+        nodes_[end].word = NIL;
+        freeWords_.push_back(w);
+        totalWords_--;
+
+        // restore "every non-root node ends a word or branches"
+        size_t k = path.size() - 1;
+        while (k > 0 && nodes_[path[k]].word == NIL && nodes_[path[k]].child == NIL) {
+            unlinkChild(path[k - 1], path[k]);
+            freeNode(path[k]);
+            --k;
+        }
+        uint32_t p = path[k];
+        if (p != ROOT && nodes_[p].word == NIL && nodes_[p].child != NIL &&
+            nodes_[nodes_[p].child].sibling == NIL)
+            mergeOnlyChild(p);
+        return true;
     }
 
     int getTotalWords() const { return totalWords_; }
 
+    size_t nodeCount() const { return nodes_.size() - freeNodes_.size(); }
+
+    size_t memoryBytes() const {
+        return sizeof(*this)
+             + nodes_.capacity() * sizeof(Node) + words_.capacity() * sizeof(Word)
+             + pool_.capacity() + idPool_.capacity()
+             + (freeNodes_.capacity() + freeWords_.capacity()) * sizeof(uint32_t);
+    }
+
     void printStats() const {
+        size_t rootChildren = 0;
+        for (uint32_t c = nodes_[ROOT].child; c != NIL; c = nodes_[c].sibling) ++rootChildren;
         cout << "\n╔══════════════════════════════════════════╗\n"
              << "║       QUESTION TRIE (Prefix Tree)        ║\n"
              << "╠══════════════════════════════════════════╣\n"
              << "║ Total words indexed: " << totalWords_ << "\n"
-             << "║ Root children: " << root_->children.size() << "\n"
+             << "║ Root children: " << rootChildren << "\n"
              << "╚══════════════════════════════════════════╝\n";
     }
 };
@@ -0,0 +1,104 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Lazy Range Views over Question Containers
+
+   Iterator adapters used by the maps' zero-copy scan API. A view holds
+   no results: each ++ walks the underlying container to the next entry
+   whose Question satisfies the predicate, and dereferencing yields a
+   const reference into the container.
+
+   A view (and its iterators) is invalidated by any insert or remove on
+   the container it was taken from.
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef RANGE_VIEW_H
+#define RANGE_VIEW_H
+
+#include "dsa_core.h"
+#include <iterator>
+#include <cstddef>
+
+using namespace std;
+
+namespace dsa {
+
+struct AcceptAll {
+    bool operator()(const Question&) const { return true; }
+};
+
+// ── Entry iterator (pair<string, Question>) → matching Questions ──
+
+template <typename It, typename Pred>
+class QuestionFilterIterator {
+private:
+    It          cur_;
+    It          end_;
+    const Pred* pred_;
+
+    void skip() {
+        while (cur_ != end_ && !(*pred_)(cur_->second)) ++cur_;
+    }
+
+public:
+    using iterator_category = forward_iterator_tag;
+    using value_type        = Question;
+    using difference_type   = ptrdiff_t;
+    using pointer           = const Question*;
+    using reference         = const Question&;
+
+    QuestionFilterIterator() : pred_(nullptr) {}
+    QuestionFilterIterator(It cur, It end, const Pred* pred)
+        : cur_(cur), end_(end), pred_(pred) { skip(); }
+
+    reference operator*()  const { return cur_->second; }
+    pointer   operator->() const { return &cur_->second; }
+
+    // key the question was stored under
+    const string& key() const { return cur_->first; }
+
+    QuestionFilterIterator& operator++() { ++cur_; skip(); return *this; }
+    QuestionFilterIterator operator++(int) { auto t = *this; ++*this; return t; }
+
+    bool operator==(const QuestionFilterIterator& o) const { return cur_ == o.cur_; }
+    bool operator!=(const QuestionFilterIterator& o) const { return cur_ != o.cur_; }
+};
+
+template <typename It, typename Pred>
+class QuestionFilterRange {
+private:
+    It   first_;
+    It   last_;
+    Pred pred_;
+
+public:
+    using iterator = QuestionFilterIterator<It, Pred>;
+
+    QuestionFilterRange(It first, It last, Pred pred)
+        : first_(first), last_(last), pred_(move(pred)) {}
+
+    // pred_ is referenced by the iterators, so the range must not move
+    QuestionFilterRange(const QuestionFilterRange&)            = delete;
+    QuestionFilterRange& operator=(const QuestionFilterRange&) = delete;
+    QuestionFilterRange(QuestionFilterRange&& o)
+        : first_(o.first_), last_(o.last_), pred_(move(o.pred_)) {}
+
+    iterator begin() const { return iterator(first_, last_, &pred_); }
+    iterator end()   const { return iterator(last_, last_, &pred_); }
+    bool     empty() const { return begin() == end(); }
+
+    size_t count() const {
+        size_t c = 0;
+        for (auto it = begin(); it != end(); ++it) c++;
+        return c;
+    }
+
+    // materialize when a copy is really wanted
+    vector<Question> toVector() const {
+        vector<Question> out;
+        for (const Question& q : *this) out.push_back(q);
+        return out;
+    }
+};
+
+} // namespace dsa
+
+#endif // RANGE_VIEW_H
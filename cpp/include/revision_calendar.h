@@ -0,0 +1,380 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Calendar Queue for Day-Granular Revision Scheduling
+
+   Data Structure : Timing wheel of WHEEL_DAYS day buckets plus an
+                    ordered overflow map for days outside the wheel's
+                    window (far future, or filed behind the cursor)
+
+   Order          : earliest due day first; inside a day, lowest
+                    Question::getPriorityScore(today) first — the same
+                    order RevisionHeap gives questions due that day
+                    (equal scores leave in slot order).
+                    A bucket is sorted once, when it is first drained
+                    for a given day, then popped from the back.
+
+   Wheel          : an occupancy bitmap finds the next non-empty day, so
+                    advancing touches one 64-day word at a time and only
+                    the buckets it lands on. Overflow days move into the
+                    wheel a whole bucket at a time as the cursor passes.
+
+   Store          : holds const Question* — the questions must keep
+                    their addresses (and ids) while queued, as with
+                    QuestionIndex. A flat id → slot table (wyhash,
+                    hashes cached per slot) serves push / remove.
+
+   Time:  push / remove → O(1) (overflow days O(log days))
+          pop → O(1) amortized + one O(b log b) sort per drained day
+          drainDueBy(D) → O(questions drained + days touched)
+   Space: O(n + WHEEL_DAYS)
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef REVISION_CALENDAR_H
+#define REVISION_CALENDAR_H
+
+#include "dsa_core.h"
+#include "question_hash.h"
+#include <algorithm>
+#include <map>
+
+using namespace std;
+
+namespace dsa {
+
+class RevisionCalendar {
+public:
+    static constexpr int32_t WHEEL_DAYS = 1024;     // ~2.8 years of day buckets
+
+private:
+    static constexpr uint32_t MASK  = WHEEL_DAYS - 1;
+    static constexpr int      WORDS = WHEEL_DAYS / 64;
+    static constexpr uint32_t NONE  = UINT32_MAX;
+
+    struct Slot {
+        const Question* q;
+        uint64_t        hash;      // of q->id — the id table never re-reads the string
+        int32_t         day;
+        uint32_t        pos;       // index in its bucket
+    };
+
+    struct Bucket {
+        vector<uint32_t> slots;                      // most urgent at the back once sorted
+        int32_t          sortedFor = EpochDay::NONE; // day the order was computed for
+    };
+
+    vector<Slot>                         slots_;
+    vector<uint32_t>                     free_;
+    vector<uint32_t>                     ids_;       // id → slot, linear probing, load ≤ 1/2
+    size_t                               count_;
+
+    vector<Bucket>                       wheel_;     // day & MASK → bucket
+    uint64_t                             occupied_[WORDS];
+    map<int32_t, Bucket>                 overflow_;  // days outside [cursor_, cursor_ + WHEEL_DAYS)
+    int32_t                              cursor_;
+    size_t                               wheelCount_;
+    vector<pair<double, uint32_t>>       keyed_;     // order() scratch
+
+    static uint32_t wheelIndex(int32_t day) { return static_cast<uint32_t>(day) & MASK; }
+
+    bool inWheel(int32_t day) const {
+        int64_t off = static_cast<int64_t>(day) - cursor_;
+        return off >= 0 && off < WHEEL_DAYS;
+    }
+
+    void setBit(uint32_t i)   { occupied_[i >> 6] |=  (1ULL << (i & 63)); }
+    void clearBit(uint32_t i) { occupied_[i >> 6] &= ~(1ULL << (i & 63)); }
+
+    // ── id → slot ──
+    static uint64_t hashId(string_view id) { return WyHash()(id); }
+
+    uint32_t findId(string_view id) const {
+        if (ids_.empty()) return NONE;
+        uint64_t h = hashId(id);
+        size_t mask = ids_.size() - 1;
+        for (size_t i = h & mask;; i = (i + 1) & mask) {
+            uint32_t s = ids_[i];
+            if (s == NONE || (slots_[s].hash == h && slots_[s].q->id == id)) return s;
+        }
+    }
+
+    void insertId(uint32_t s) {
+        if ((count_ + 1) * 2 > ids_.size()) {
+            vector<uint32_t> old(max<size_t>(16, ids_.size() * 2), NONE);
+            old.swap(ids_);
+            size_t mask = ids_.size() - 1;
+            for (uint32_t o : old) {
+                if (o == NONE) continue;
+                size_t i = slots_[o].hash & mask;
+                while (ids_[i] != NONE) i = (i + 1) & mask;
+                ids_[i] = o;
+            }
+        }
+        size_t mask = ids_.size() - 1;
+        size_t i = slots_[s].hash & mask;
+        while (ids_[i] != NONE) i = (i + 1) & mask;
+        ids_[i] = s;
+        count_++;
+    }
+
+    // backward-shift delete
+    void eraseId(uint32_t s) {
+        size_t mask = ids_.size() - 1;
+        size_t i = slots_[s].hash & mask;
+        while (ids_[i] != s) i = (i + 1) & mask;
+        for (size_t j = i;;) {
+            j = (j + 1) & mask;
+            if (ids_[j] == NONE) break;
+            size_t home = slots_[ids_[j]].hash & mask;
+            bool stays = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+            if (!stays) { ids_[i] = ids_[j]; i = j; }
+        }
+        ids_[i] = NONE;
+        count_--;
+    }
+
+    static bool schedulable(const Question& q) {
+        return q.status != QuestionStatus::MASTERED && !q.nextRevisionDate.empty();
+    }
+
+    // ── Filing ──
+    void file(uint32_t s) {
+        int32_t day = slots_[s].day;
+        Bucket& b = inWheel(day) ? wheel_[wheelIndex(day)] : overflow_[day];
+        slots_[s].pos = static_cast<uint32_t>(b.slots.size());
+        b.slots.push_back(s);
+        b.sortedFor = EpochDay::NONE;
+        if (inWheel(day)) { wheelCount_++; setBit(wheelIndex(day)); }
+    }
+
+    // swap-remove; taking the back keeps a sorted bucket sorted
+    void unfile(uint32_t s) {
+        int32_t day = slots_[s].day;
+        bool wheel = inWheel(day);
+        auto it = wheel ? overflow_.end() : overflow_.find(day);
+        Bucket& b = wheel ? wheel_[wheelIndex(day)] : it->second;
+
+        uint32_t pos = slots_[s].pos;
+        uint32_t moved = b.slots.back();
+        if (moved != s) {
+            b.slots[pos] = moved;
+            slots_[moved].pos = pos;
+            b.sortedFor = EpochDay::NONE;
+        }
+        b.slots.pop_back();
+
+        if (wheel) {
+            wheelCount_--;
+            if (b.slots.empty()) clearBit(wheelIndex(day));
+        } else if (b.slots.empty()) {
+            overflow_.erase(it);
+        }
+    }
+
+    uint32_t acquire(const Question* q, uint64_t hash) {
+        uint32_t s;
+        if (!free_.empty()) { s = free_.back(); free_.pop_back(); }
+        else {
+            if (slots_.size() >= NONE) throw length_error("RevisionCalendar — too many questions!");
+            s = static_cast<uint32_t>(slots_.size());
+            slots_.emplace_back();
+        }
+        slots_[s] = Slot{q, hash, q->nextRevisionDate.days, 0};
+        insertId(s);
+        return s;
+    }
+
+    void release(uint32_t s) {
+        eraseId(s);
+        slots_[s].q = nullptr;
+        free_.push_back(s);
+    }
+
+    // ── Cursor ──
+    // Only called with no wheel entries before `to`, so nothing already in
+    // the wheel changes bucket; overflow days now inside the window move in.
+    void moveCursor(int32_t to) {
+        cursor_ = to;
+        for (auto it = overflow_.lower_bound(cursor_); it != overflow_.end() && inWheel(it->first);) {
+            Bucket& dst = wheel_[wheelIndex(it->first)];
+            dst.slots.swap(it->second.slots);
+            dst.sortedFor = it->second.sortedFor;
+            wheelCount_ += dst.slots.size();
+            setBit(wheelIndex(it->first));
+            it = overflow_.erase(it);
+        }
+    }
+
+    // offset from wheel index `from` to the next occupied bucket, cyclic
+    int nextOccupied(uint32_t from) const {
+        uint32_t w0 = from >> 6;
+        for (int k = 0; k <= WORDS; ++k) {
+            uint32_t w = (w0 + k) % WORDS;
+            uint64_t bits = occupied_[w];
+            if (k == 0)     bits &= ~0ULL << (from & 63);
+            if (k == WORDS) bits &= (1ULL << (from & 63)) - 1;   // wrapped into the first word
+            if (bits) {
+                uint32_t idx = w * 64 + static_cast<uint32_t>(__builtin_ctzll(bits));
+                return static_cast<int>((idx - from) & MASK);
+            }
+        }
+        return -1;
+    }
+
+    // earliest day holding questions, moving the cursor up to it
+    int32_t earliestDay() {
+        if (count_ == 0) return EpochDay::NONE;
+        if (!overflow_.empty() && overflow_.begin()->first < cursor_)
+            return overflow_.begin()->first;                 // filed behind the cursor
+        if (wheelCount_ == 0) moveCursor(overflow_.begin()->first);
+        int off = nextOccupied(wheelIndex(cursor_));
+        if (off > 0) moveCursor(cursor_ + off);
+        return cursor_;
+    }
+
+    Bucket& bucketAt(int32_t day) {
+        return inWheel(day) ? wheel_[wheelIndex(day)] : overflow_.find(day)->second;
+    }
+
+    // most urgent at the back: descending score, equal scores by slot
+    void order(Bucket& b, EpochDay today) {
+        if (b.sortedFor == today.days) return;
+        keyed_.clear();
+        keyed_.reserve(b.slots.size());
+        for (uint32_t s : b.slots) keyed_.emplace_back(slots_[s].q->getPriorityScore(today), s);
+        sort(keyed_.begin(), keyed_.end(), greater<pair<double, uint32_t>>());
+        for (size_t i = 0; i < keyed_.size(); ++i) {
+            b.slots[i] = keyed_[i].second;
+            slots_[keyed_[i].second].pos = static_cast<uint32_t>(i);
+        }
+        b.sortedFor = today.days;
+    }
+
+public:
+    RevisionCalendar() : count_(0), wheel_(WHEEL_DAYS), cursor_(0), wheelCount_(0) {
+        fill(begin(occupied_), end(occupied_), 0ULL);
+    }
+
+    RevisionCalendar(const RevisionCalendar&)            = delete;
+    RevisionCalendar& operator=(const RevisionCalendar&) = delete;
+
+    // bulk-file a deck; the vector must outlive the calendar and not reallocate.
+    // The wheel starts at the earliest due day, so only days a full window
+    // past it overflow. Same result as push() per question (a repeated id
+    // keeps the last copy), minus push()'s cursor restart.
+    explicit RevisionCalendar(const vector<Question>& deck) : RevisionCalendar() {
+        int32_t first = INT32_MAX;
+        for (const auto& q : deck)
+            if (schedulable(q)) first = min(first, q.nextRevisionDate.days);
+        if (first == INT32_MAX) return;
+        cursor_ = first;
+        slots_.reserve(deck.size());
+        for (const auto& q : deck) {
+            remove(q.id);
+            if (schedulable(q)) file(acquire(&q, hashId(q.id)));
+        }
+    }
+
+    // ── Enqueue / re-file — O(1) ──
+    // An id already queued is moved to q's current due day. Returns false
+    // (and drops the id) for questions with nothing to schedule.
+    bool push(const Question* q) {
+        uint32_t old = findId(q->id);
+        if (old != NONE) {
+            unfile(old);
+            release(old);
+        }
+        if (!schedulable(*q)) return false;
+
+        int32_t day = q->nextRevisionDate.days;
+        // nothing in the wheel: restart it at this day rather than overflow
+        if (count_ == 0 || (day < cursor_ && wheelCount_ == 0)) moveCursor(day);
+        file(acquire(q, hashId(q->id)));
+        return true;
+    }
+
+    bool remove(string_view id) {
+        uint32_t s = findId(id);
+        if (s == NONE) return false;
+        unfile(s);
+        release(s);
+        return true;
+    }
+
+    bool contains(string_view id) const { return findId(id) != NONE; }
+
+    // ── Dequeue ──
+    // earliest due day first; within the day, lowest getPriorityScore(today)
+    const Question& pop(EpochDay today) {
+        int32_t day = earliestDay();
+        if (day == EpochDay::NONE) throw runtime_error("RevisionCalendar::pop() — empty!");
+        Bucket& b = bucketAt(day);
+        order(b, today);
+        uint32_t s = b.slots.back();
+        const Question* q = slots_[s].q;
+        unfile(s);
+        release(s);
+        return *q;
+    }
+
+    // first due day still queued (EpochDay() if empty)
+    EpochDay nextDueDay() {
+        int32_t day = earliestDay();
+        return day == EpochDay::NONE ? EpochDay() : EpochDay(day);
+    }
+
+    // ── Range drain: everything due on or before `dueBy` ──
+    // Day by day, each day in pop() order for `dueBy`. A whole bucket is
+    // detached before fn runs, so fn may push() the question back (e.g.
+    // after completeRevision); one re-filed on or before `dueBy` is
+    // drained again.
+    template <typename Fn>      // fn(const Question&)
+    size_t drainDueBy(EpochDay dueBy, Fn&& fn) {
+        size_t n = 0;
+        vector<uint32_t> taken;
+        for (int32_t day; (day = earliestDay()) != EpochDay::NONE && day <= dueBy.days;) {
+            Bucket& b = bucketAt(day);
+            order(b, dueBy);
+            taken.clear();
+            taken.swap(b.slots);
+            b.sortedFor = EpochDay::NONE;
+            if (inWheel(day)) { wheelCount_ -= taken.size(); clearBit(wheelIndex(day)); }
+            else overflow_.erase(day);
+
+            vector<const Question*> due;
+            due.reserve(taken.size());
+            for (auto it = taken.rbegin(); it != taken.rend(); ++it) {
+                due.push_back(slots_[*it].q);
+                release(*it);
+            }
+            for (const Question* q : due) fn(*q);
+            n += due.size();
+        }
+        return n;
+    }
+
+    vector<const Question*> drainDueBy(EpochDay dueBy) {
+        vector<const Question*> out;
+        drainDueBy(dueBy, [&](const Question& q) { out.push_back(&q); });
+        return out;
+    }
+
+    size_t size()  const { return count_; }
+    bool   empty() const { return count_ == 0; }
+
+    // distinct days parked outside the wheel's window
+    size_t overflowDays() const { return overflow_.size(); }
+
+    void printStats() const {
+        cout << "\n╔══════════════════════════════════════════╗\n"
+             << "║     REVISION CALENDAR (Timing Wheel)     ║\n"
+             << "╠══════════════════════════════════════════╣\n"
+             << "║ Queued: " << size() << " | Wheel: " << wheelCount_
+             << " | Overflow days: " << overflow_.size() << "\n"
+             << "║ Cursor: " << (empty() ? string("N/A") : EpochDay(cursor_).toString())
+             << " | Window: " << WHEEL_DAYS << " days\n"
+             << "╚══════════════════════════════════════════╝\n";
+    }
+};
+
+} // namespace dsa
+
+#endif // REVISION_CALENDAR_H
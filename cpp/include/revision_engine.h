@@ -12,6 +12,7 @@
 #define REVISION_ENGINE_H
 
 #include "dsa_core.h"
+#include "question_table.h"
 #include <cmath>
 
 using namespace std;
@@ -25,9 +26,9 @@ public:
     static constexpr int INTERVAL_2 = 3;   // 3 days after second revision
     static constexpr double EF_MIN  = 1.3; // minimum ease factor
 
-    // ── SM-2: Calculate next revision date ──
+    // ── SM-2: Interval in days for the question's current cycle ──
 
-    static string calculateNextDate(const Question& q) {
+    static int nextInterval(const Question& q) {
         int interval;
 
         if (q.revisionCycle <= 1) {
@@ -47,12 +48,22 @@ public:
         double diffMult = 1.0;
         if (q.difficulty == Difficulty::HARD)   diffMult = 0.8;
         if (q.difficulty == Difficulty::EASY)   diffMult = 1.2;
-        interval = max(1, static_cast<int>(ceil(interval * diffMult)));
+        return max(1, static_cast<int>(ceil(interval * diffMult)));
+    }
 
-        string baseDate = q.lastRevisionDate.empty() ? q.dateSolved : q.lastRevisionDate;
-        if (baseDate.empty()) baseDate = todayStr();
+    // ── SM-2: Calculate next revision date ──
+    //   `today` is only used when the question has no solve/revision date
 
-        return addDaysToDate(baseDate, interval);
+    static EpochDay calculateNextDate(const Question& q, EpochDay today) {
+        EpochDay baseDate = q.lastRevisionDate.empty() ? q.dateSolved : q.lastRevisionDate;
+        if (baseDate.empty()) baseDate = today;
+        return addDaysToDate(baseDate, nextInterval(q));
+    }
+
+    static EpochDay calculateNextDate(const Question& q) {
+        if (q.lastRevisionDate.empty() && q.dateSolved.empty())
+            return calculateNextDate(q, EpochDay::today());
+        return calculateNextDate(q, EpochDay());
     }
 
     // ── SM-2: Update ease factor based on quality (0–5) ──
@@ -73,13 +84,18 @@ public:
         double newEaseFactor;
         int    newCycle;
         int    newStreak;
-        string nextDate;
+        EpochDay nextDate;
         QuestionStatus newStatus;
         int    xpAwarded;
         bool   wasReset;
     };
 
     static RevisionResult completeRevision(Question& q, int quality, int timeTaken = 0) {
+        return completeRevision(q, quality, timeTaken, EpochDay::today());
+    }
+
+    // same, with the revision day supplied by the caller (simulation, replay)
+    static RevisionResult completeRevision(Question& q, int quality, int timeTaken, EpochDay today) {
         RevisionResult result;
         result.wasReset = false;
 
@@ -112,8 +128,8 @@ public:
         result.newStatus = q.status;
 
         // calculate next date
-        q.lastRevisionDate = todayStr();
-        result.nextDate = calculateNextDate(q);
+        q.lastRevisionDate = today;
+        result.nextDate = calculateNextDate(q, today);
         q.nextRevisionDate = result.nextDate;
 
         // award XP
@@ -155,8 +171,8 @@ public:
 
     // ── Get questions due today ──
 
-    static vector<Question> getDueToday(const vector<Question>& questions) {
-        string today = todayStr();
+    static vector<Question> getDueToday(const vector<Question>& questions,
+                                        EpochDay today = EpochDay::today()) {
         vector<Question> due;
         for (const auto& q : questions) {
             if (q.status == QuestionStatus::MASTERED) continue;
@@ -169,8 +185,8 @@ public:
 
     // ── Get overdue questions (past due date) ──
 
-    static vector<Question> getOverdue(const vector<Question>& questions) {
-        string today = todayStr();
+    static vector<Question> getOverdue(const vector<Question>& questions,
+                                       EpochDay today = EpochDay::today()) {
         vector<Question> overdue;
         for (const auto& q : questions) {
             if (q.status == QuestionStatus::MASTERED) continue;
@@ -183,9 +199,9 @@ public:
 
     // ── Get upcoming revisions (next N days) ──
 
-    static vector<Question> getUpcoming(const vector<Question>& questions, int days = 7) {
-        string today = todayStr();
-        string future = addDaysToDate(today, days);
+    static vector<Question> getUpcoming(const vector<Question>& questions, int days = 7,
+                                        EpochDay today = EpochDay::today()) {
+        EpochDay future = today + days;
         vector<Question> upcoming;
         for (const auto& q : questions) {
             if (q.status == QuestionStatus::MASTERED) continue;
@@ -196,6 +212,23 @@ public:
         return upcoming;
     }
 
+    // ── Columnar variants — scan the due-day column, return row ids ──
+
+    static vector<QuestionTable::RowId> getDueToday(const QuestionTable& table,
+                                                    EpochDay today = EpochDay::today()) {
+        return table.rowsDueBy(today);
+    }
+
+    static vector<QuestionTable::RowId> getOverdue(const QuestionTable& table,
+                                                   EpochDay today = EpochDay::today()) {
+        return table.rowsDueBy(today - 1);
+    }
+
+    static vector<QuestionTable::RowId> getUpcoming(const QuestionTable& table, int days = 7,
+                                                    EpochDay today = EpochDay::today()) {
+        return table.rowsDueBetween(today + 1, today + days);
+    }
+
     // ── Difficulty rating suggestion ──
 
     static string suggestAction(const Question& q) {
@@ -1,145 +1,665 @@
 /* ═══════════════════════════════════════════════════════════════════
    DSA Tracker — Min-Heap Priority Queue for Revision Scheduling
-   
-   Data Structure : Binary Min-Heap (array-based)
-   
-   Time:  Push / Pop → O(log n)   |   Peek → O(1)   |   Build → O(n)
-   Space: O(n)
+
+   Data Structure : d-ary Min-Heap (array-based) of (score, handle)
+                    nodes; the handle indexes the store that owns the
+                    Question, so sifts never touch question data
+
+   Layout         : BasicRevisionHeap<Arity, Layout>
+                    Arity 2 / 4 / 8 — wider nodes give a shallower tree
+                    (fewer levels per push, more compares per pop level)
+                    NODES      — 16-byte {score, handle} nodes
+                    SPLIT_KEYS — scores in their own array, handles apart;
+                                 siftDown compares scores only
+                    The key array is cache-line aligned and shifted by
+                    Arity − 1 slots, so every sibling group starts on a
+                    group boundary: 4 nodes or 8 split keys fill exactly
+                    one 64-byte line.
+                    RevisionHeap = BasicRevisionHeap<2, NODES>
+
+   Store          : owned    — the default: queued questions are copied
+                    (or, from an rvalue deck, moved) into an internal
+                    deque
+                    borrowed — opt-in through borrowing(deck[, today]);
+                    the handle is an index into the caller's vector (no
+                    copies; the vector must outlive the heap and not
+                    reallocate)
+
+   Addressable    : handle → heap position, plus an open-addressing
+                    id → handle table, so remove / updatePriority find
+                    their node in O(1)
+
+   Time:  Push / Pop / Remove / Update → O(log n)   |   Peek → O(1)   |   Build → O(n)
+          Top-K → O(k·d log k), const
+   Space: O(n). Borrowing, node and position arrays are sized for the
+          whole store: ~22 bytes per deck question, so ~88 per queued
+          question when a quarter of the deck is due (bench deck,
+          heap.buildBorrowed bytes_per_entry)
    ═══════════════════════════════════════════════════════════════════ */
 
 #ifndef REVISION_HEAP_H
 #define REVISION_HEAP_H
 
 #include "dsa_core.h"
+#include "metrics.h"
+#include "question_hash.h"
 #include <vector>
+#include <deque>
+#include <algorithm>
 #include <stdexcept>
+#include <memory_resource>
+#include <cstring>
+#include <type_traits>
 
 using namespace std;
 
 namespace dsa {
 
+// value handed out by pop() / topK()
 struct HeapEntry {
     Question question;
     double   priorityScore;   // lower = more urgent
 
     HeapEntry() : priorityScore(0.0) {}
     HeapEntry(const Question& q, double s) : question(q), priorityScore(s) {}
+    HeapEntry(Question&& q, double s) : question(move(q)), priorityScore(s) {}
 
     bool operator>(const HeapEntry& o) const { return priorityScore > o.priorityScore; }
     bool operator<(const HeapEntry& o) const { return priorityScore < o.priorityScore; }
 };
 
-class RevisionHeap {
+// zero-copy view of a queued question (top())
+struct HeapRef {
+    const Question& question;
+    double          priorityScore;
+};
+
+enum class HeapLayout { NODES, SPLIT_KEYS };
+
+struct HeapNode {
+    double   score;
+    uint32_t handle;
+};
+static_assert(sizeof(HeapNode) <= 16, "heap node must stay 16 bytes");
+
+// ── Growable array of trivially copyable T on a cache-line boundary ──
+// LEAD unused slots sit in front of element 0, so with LEAD = Arity − 1
+// the children of i (Arity·i + 1 …) start at a multiple of Arity.
+template <typename T, size_t LEAD>
+class AlignedHeapArray {
+    static_assert(is_trivially_copyable<T>::value, "AlignedHeapArray holds plain data");
+
+public:
+    static constexpr size_t CACHE_LINE = 64;
+
 private:
-    vector<HeapEntry> heap_;
+    pmr::memory_resource* mr_;
+    T*     base_;
+    size_t size_, cap_;
+
+    void reallocate(size_t cap) {
+        T* nb = static_cast<T*>(mr_->allocate((LEAD + cap) * sizeof(T), CACHE_LINE));
+        if (size_) memcpy(nb + LEAD, base_ + LEAD, size_ * sizeof(T));
+        release();
+        base_ = nb;
+        cap_  = cap;
+    }
+
+    void release() {
+        if (base_) mr_->deallocate(base_, (LEAD + cap_) * sizeof(T), CACHE_LINE);
+        base_ = nullptr;
+        cap_  = 0;
+    }
+
+public:
+    explicit AlignedHeapArray(pmr::memory_resource* mr) : mr_(mr), base_(nullptr), size_(0), cap_(0) {}
+
+    // copies go to the default resource, like pmr containers
+    AlignedHeapArray(const AlignedHeapArray& o) : AlignedHeapArray(pmr::get_default_resource()) { *this = o; }
+
+    AlignedHeapArray(AlignedHeapArray&& o) noexcept
+        : mr_(o.mr_), base_(o.base_), size_(o.size_), cap_(o.cap_) {
+        o.base_ = nullptr;
+        o.size_ = o.cap_ = 0;
+    }
+
+    AlignedHeapArray& operator=(const AlignedHeapArray& o) {
+        if (this == &o) return *this;
+        size_ = 0;
+        reserve(o.size_);
+        if (o.size_) memcpy(base_ + LEAD, o.base_ + LEAD, o.size_ * sizeof(T));
+        size_ = o.size_;
+        return *this;
+    }
+
+    AlignedHeapArray& operator=(AlignedHeapArray&& o) noexcept {
+        if (this == &o) return *this;
+        if (mr_->is_equal(*o.mr_)) {
+            release();
+            base_ = o.base_; size_ = o.size_; cap_ = o.cap_;
+            o.base_ = nullptr;
+            o.size_ = o.cap_ = 0;
+            return *this;
+        }
+        return *this = static_cast<const AlignedHeapArray&>(o);
+    }
+
+    ~AlignedHeapArray() { release(); }
+
+    T&       operator[](size_t i)       { return base_[LEAD + i]; }
+    const T& operator[](size_t i) const { return base_[LEAD + i]; }
+
+    size_t size()  const { return size_; }
+    size_t bytes() const { return cap_ ? (LEAD + cap_) * sizeof(T) : 0; }
+
+    void reserve(size_t n) { if (n > cap_) reallocate(n); }
+
+    void push_back(const T& v) {
+        if (size_ == cap_) reallocate(max<size_t>(16, cap_ * 2));
+        base_[LEAD + size_++] = v;
+    }
+
+    void pop_back() { --size_; }
+};
+
+// ── Storage: one array of nodes ──
+template <int Arity, HeapLayout Layout>
+class HeapStorage {
+    AlignedHeapArray<HeapNode, Arity - 1> nodes_;
+
+public:
+    explicit HeapStorage(pmr::memory_resource* mr) : nodes_(mr) {}
+
+    HeapNode get(size_t i)           const { return nodes_[i]; }
+    double   key(size_t i)           const { return nodes_[i].score; }
+    uint32_t handle(size_t i)        const { return nodes_[i].handle; }
+    void     set(size_t i, HeapNode n)     { nodes_[i] = n; }
+    void     setKey(size_t i, double k)    { nodes_[i].score = k; }
+    void     push_back(HeapNode n)         { nodes_.push_back(n); }
+    void     pop_back()                    { nodes_.pop_back(); }
+    void     reserve(size_t n)             { nodes_.reserve(n); }
+    size_t   size()  const                 { return nodes_.size(); }
+    size_t   bytes() const                 { return nodes_.bytes(); }
+};
+
+// ── Storage: keys and handles in parallel arrays ──
+template <int Arity>
+class HeapStorage<Arity, HeapLayout::SPLIT_KEYS> {
+    AlignedHeapArray<double, Arity - 1> keys_;
+    pmr::vector<uint32_t>               handles_;
+
+public:
+    explicit HeapStorage(pmr::memory_resource* mr) : keys_(mr), handles_(mr) {}
+
+    HeapNode get(size_t i)           const { return {keys_[i], handles_[i]}; }
+    double   key(size_t i)           const { return keys_[i]; }
+    uint32_t handle(size_t i)        const { return handles_[i]; }
+    void     set(size_t i, HeapNode n)     { keys_[i] = n.score; handles_[i] = n.handle; }
+    void     setKey(size_t i, double k)    { keys_[i] = k; }
+    void     push_back(HeapNode n)         { keys_.push_back(n.score); handles_.push_back(n.handle); }
+    void     pop_back()                    { keys_.pop_back(); handles_.pop_back(); }
+    void     reserve(size_t n)             { keys_.reserve(n); handles_.reserve(n); }
+    size_t   size()  const                 { return keys_.size(); }
+    size_t   bytes() const                 { return keys_.bytes() + handles_.capacity() * sizeof(uint32_t); }
+};
+
+template <int Arity = 2, HeapLayout Layout = HeapLayout::NODES>
+class BasicRevisionHeap {
+    static_assert(Arity == 2 || Arity == 4 || Arity == 8, "RevisionHeap arity must be 2, 4 or 8");
+
+public:
+    using Handle = uint32_t;
+    static constexpr Handle     NIL    = UINT32_MAX;
+    static constexpr int        ARITY  = Arity;
+    static constexpr HeapLayout LAYOUT = Layout;
+
+private:
+    using Node = HeapNode;
+
+    HeapStorage<Arity, Layout> st_;
+    pmr::vector<uint32_t> pos_;          // handle → heap index, NIL if not queued
+
+    // ── Store ──
+    bool                  borrowing_;
+    const Question*       borrowed_;
+    size_t                borrowedCount_;
+    pmr::deque<Question>  owned_;        // deque: questions never move
+    pmr::vector<Handle>   freeHandles_;
+
+    // ── id → handle (linear probing, backward-shift delete) ──
+    pmr::vector<Handle>   ids_;
+    size_t                idCount_;
+
+    static int parent(int i)     { return (i - 1) / Arity; }
+    static int firstChild(int i) { return Arity * i + 1; }
+
+    static size_t hashId(string_view id) { return WyHash()(id); }
+
+    const Question& q(Handle h) const { return borrowing_ ? borrowed_[h] : owned_[h]; }
+
+    // ── id table ──
+    Handle findId(string_view id) const {
+        if (ids_.empty()) return NIL;
+        size_t mask = ids_.size() - 1;
+        for (size_t i = hashId(id) & mask;; i = (i + 1) & mask) {
+            Handle h = ids_[i];
+            if (h == NIL || q(h).id == id) return h;
+        }
+    }
+
+    void insertId(Handle h) {
+        if ((idCount_ + 1) * 2 > ids_.size()) growIds();
+        size_t mask = ids_.size() - 1;
+        size_t i = hashId(q(h).id) & mask;
+        while (ids_[i] != NIL) i = (i + 1) & mask;
+        ids_[i] = h;
+        idCount_++;
+    }
+
+    // call while q(h).id still holds the key it was filed under
+    void eraseId(Handle h) {
+        size_t mask = ids_.size() - 1;
+        size_t i = hashId(q(h).id) & mask;
+        while (ids_[i] != h && ids_[i] != NIL) i = (i + 1) & mask;
+        if (ids_[i] == NIL)     // id edited in a borrowed store — fall back to a scan
+            for (i = 0; ids_[i] != h; ++i) {}
+        for (size_t j = i;;) {
+            j = (j + 1) & mask;
+            if (ids_[j] == NIL) break;
+            size_t home = hashId(q(ids_[j]).id) & mask;
+            // move j back into the hole unless its home lies in (i, j]
+            bool stays = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+            if (!stays) { ids_[i] = ids_[j]; i = j; }
+        }
+        ids_[i] = NIL;
+        idCount_--;
+    }
+
+    void growIds() {
+        pmr::vector<Handle> old(max<size_t>(16, ids_.size() * 2), NIL, ids_.get_allocator());
+        old.swap(ids_);
+        idCount_ = 0;
+        for (Handle h : old)
+            if (h != NIL) insertId(h);
+    }
+
+    // ── Store ──
+    // handle of a question that lives in the borrowed store, else NIL
+    Handle handleOf(const Question& x) const {
+        less<const Question*> lt;
+        if (!borrowing_ || lt(&x, borrowed_) || !lt(&x, borrowed_ + borrowedCount_)) return NIL;
+        return static_cast<Handle>(&x - borrowed_);
+    }
+
+    Handle storeCopy(const Question& x) {
+        Handle h;
+        if (!freeHandles_.empty()) { h = freeHandles_.back(); freeHandles_.pop_back(); owned_[h] = x; }
+        else {
+            if (owned_.size() >= NIL) throw length_error("RevisionHeap — too many questions!");
+            h = static_cast<Handle>(owned_.size());
+            owned_.push_back(x);
+            pos_.push_back(NIL);
+        }
+        return h;
+    }
 
-    static int parent(int i)     { return (i - 1) / 2; }
-    static int leftChild(int i)  { return 2 * i + 1; }
-    static int rightChild(int i) { return 2 * i + 2; }
+    void releaseHandle(Handle h) {
+        if (borrowing_) return;
+        owned_[h] = Question();
+        freeHandles_.push_back(h);
+    }
+
+    // ── Heap array ──
+    void place(int i, Node n) {
+        st_.set(i, n);
+        pos_[n.handle] = static_cast<uint32_t>(i);
+    }
 
-    // Bubble up — O(log n)
+    // Bubble up — O(log n); the node is lifted out once and dropped into its hole
     void siftUp(int i) {
+        int depth = 0;
+        Node n = st_.get(i);
         while (i > 0) {
             int p = parent(i);
-            if (heap_[i] < heap_[p]) { swap(heap_[i], heap_[p]); i = p; }
+            if (n.score < st_.key(p)) { place(i, st_.get(p)); i = p; ++depth; }
             else break;
         }
+        place(i, n);
+        DSA_METRIC_ADD(HEAP_SIFT_STEPS, depth);
+        DSA_METRIC_RECORD(HEAP_SIFT_DEPTH, depth);
     }
 
-    // Bubble down — O(log n)
+    // Bubble down — O(d log_d n); one scan over each sibling group
     void siftDown(int i) {
-        int n = static_cast<int>(heap_.size());
+        int n = static_cast<int>(st_.size());
+        int depth = 0;
+        Node x = st_.get(i);
         while (true) {
-            int smallest = i;
-            int l = leftChild(i), r = rightChild(i);
-            if (l < n && heap_[l] < heap_[smallest]) smallest = l;
-            if (r < n && heap_[r] < heap_[smallest]) smallest = r;
-            if (smallest != i) { swap(heap_[i], heap_[smallest]); i = smallest; }
-            else break;
+            int first = firstChild(i);
+            if (first >= n) break;
+            int last = min(first + Arity, n);
+            int smallest = first;
+            double best = st_.key(first);
+            for (int c = first + 1; c < last; ++c) {
+                double k = st_.key(c);
+                if (k < best) { best = k; smallest = c; }
+            }
+            if (!(best < x.score)) break;
+            place(i, st_.get(smallest));
+            i = smallest;
+            ++depth;
         }
+        place(i, x);
+        DSA_METRIC_ADD(HEAP_SIFT_STEPS, depth);
+        DSA_METRIC_RECORD(HEAP_SIFT_DEPTH, depth);
     }
 
-public:
-    RevisionHeap() = default;
-
-    // Floyd's build-heap — O(n)
-    RevisionHeap(const vector<Question>& questions, const string& today) {
-        heap_.reserve(questions.size());
-        for (const auto& q : questions) {
-            if (q.status == QuestionStatus::MASTERED || q.nextRevisionDate.empty())
-                continue;
-            double score = q.getPriorityScore(today);
-            if (score >= 0) heap_.emplace_back(q, score);
+    // restore order after node i changed in either direction
+    void fix(int i) {
+        if (i > 0 && st_.key(i) < st_.key(parent(i))) siftUp(i);
+        else siftDown(i);
+    }
+
+    // takes node i out of the array; store and id table untouched
+    Node detach(int i) {
+        Node out = st_.get(i);
+        pos_[out.handle] = NIL;
+        int last = static_cast<int>(st_.size()) - 1;
+        if (i != last) place(i, st_.get(last));
+        st_.pop_back();
+        if (i < last) fix(i);
+        return out;
+    }
+
+    // queue (or re-score) handle h; a different handle with the same id is dropped
+    void enqueue(Handle h, double score, bool sift) {
+        if (pos_[h] != NIL) {
+            st_.setKey(pos_[h], score);
+            if (sift) fix(static_cast<int>(pos_[h]));
+            return;
+        }
+        Handle other = findId(q(h).id);
+        if (other != NIL) {
+            // same id under another handle: take over its node
+            uint32_t at = pos_[other];
+            pos_[other] = NIL;
+            eraseId(other);
+            releaseHandle(other);
+            insertId(h);
+            st_.set(at, Node{score, h});
+            pos_[h] = at;
+            if (sift) fix(static_cast<int>(at));
+            return;
         }
-        for (int i = static_cast<int>(heap_.size()) / 2 - 1; i >= 0; --i)
+        insertId(h);
+        pos_[h] = static_cast<uint32_t>(st_.size());
+        st_.push_back(Node{score, h});
+        if (sift) siftUp(static_cast<int>(st_.size()) - 1);
+    }
+
+    void removeHandle(Handle h) {
+        detach(static_cast<int>(pos_[h]));
+        eraseId(h);
+        releaseHandle(h);
+    }
+
+    // Floyd's bottom-up pass over nodes queued with sift = false — O(n)
+    void heapify() {
+        if (empty()) return;
+        for (int i = parent(size() - 1); i >= 0; --i)
             siftDown(i);
     }
 
-    void push(const Question& q, const string& today) {
-        heap_.emplace_back(q, q.getPriorityScore(today));
-        siftUp(static_cast<int>(heap_.size()) - 1);
+    // build-heap over the whole store — O(n); a repeated id keeps the last copy
+    template <typename KeyFn>       // bool keyOf(const Question&, double& key)
+    void buildFrom(size_t count, KeyFn&& keyOf) {
+        st_.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            Handle h = static_cast<Handle>(i);
+            double key;
+            if (keyOf(q(h), key)) enqueue(h, key, false);
+            else if (!borrowing_) releaseHandle(h);
+        }
+        heapify();
+    }
+
+    // queued-on-build rule: schedulable and already due (score ≥ 0)
+    static auto dueOn(EpochDay today) {
+        return [today](const Question& x, double& score) {
+            if (x.status == QuestionStatus::MASTERED || x.nextRevisionDate.empty()) return false;
+            score = x.getPriorityScore(today);
+            return score >= 0;
+        };
+    }
+
+    // store handle for x, copying it in for an owned store
+    Handle admit(const Question& x) {
+        if (borrowing_) {
+            Handle h = handleOf(x);
+            if (h == NIL) throw invalid_argument("RevisionHeap::push() — question is not in the borrowed store!");
+            return h;
+        }
+        Handle h = findId(x.id);
+        if (h == NIL) return storeCopy(x);
+        if (&owned_[h] != &x) owned_[h] = x;
+        return h;
+    }
+
+    struct BorrowTag {};
+
+    // empty heap over a borrowed store — see borrowing()
+    BasicRevisionHeap(BorrowTag, const vector<Question>& questions, pmr::memory_resource* mr)
+        : BasicRevisionHeap(mr) {
+        if (questions.size() >= NIL) throw length_error("RevisionHeap — too many questions!");
+        borrowing_     = true;
+        borrowed_      = questions.data();
+        borrowedCount_ = questions.size();
+        pos_.assign(questions.size(), NIL);
+    }
+
+public:
+    explicit BasicRevisionHeap(pmr::memory_resource* mr = pmr::get_default_resource())
+        : st_(mr), pos_(mr), borrowing_(false), borrowed_(nullptr), borrowedCount_(0),
+          owned_(mr), freeHandles_(mr), ids_(mr), idCount_(0) {}
+
+    // Copies the questions due on `today` into the owned store — O(n) build
+    BasicRevisionHeap(const vector<Question>& questions, EpochDay today,
+                      pmr::memory_resource* mr = pmr::get_default_resource())
+        : BasicRevisionHeap(mr) {
+        auto due = dueOn(today);
+        for (const auto& x : questions) {
+            double key;
+            if (due(x, key)) enqueue(admit(x), key, false);
+        }
+        heapify();
+    }
+
+    // Takes ownership of a temporary deck (moved into the internal store)
+    BasicRevisionHeap(vector<Question>&& questions, EpochDay today,
+                      pmr::memory_resource* mr = pmr::get_default_resource())
+        : BasicRevisionHeap(mr) {
+        if (questions.size() >= NIL) throw length_error("RevisionHeap — too many questions!");
+        owned_.assign(make_move_iterator(questions.begin()), make_move_iterator(questions.end()));
+        pos_.assign(owned_.size(), NIL);
+        questions.clear();
+        buildFrom(owned_.size(), dueOn(today));
+    }
+
+    BasicRevisionHeap(const vector<Question>& questions, const string& today,
+                      pmr::memory_resource* mr = pmr::get_default_resource())
+        : BasicRevisionHeap(questions, EpochDay::parse(today), mr) {}
+
+    // ── Borrowing — opt-in, nothing is copied ──
+    // Handles index straight into `questions`, so the vector must outlive
+    // the heap (and any copy of it) and must not be resized or reallocated
+    // while the heap is in use. push() / updatePriority() take only its
+    // elements — edit one in place, then re-score it.
+    static BasicRevisionHeap borrowing(const vector<Question>& questions,
+                                       pmr::memory_resource* mr = pmr::get_default_resource()) {
+        return BasicRevisionHeap(BorrowTag(), questions, mr);
+    }
+
+    // ...and queue every question due on `today` — O(n)
+    static BasicRevisionHeap borrowing(const vector<Question>& questions, EpochDay today,
+                                       pmr::memory_resource* mr = pmr::get_default_resource()) {
+        BasicRevisionHeap h(BorrowTag(), questions, mr);
+        h.buildFrom(questions.size(), dueOn(today));
+        return h;
+    }
+
+    static BasicRevisionHeap borrowing(vector<Question>&&, pmr::memory_resource* = nullptr) = delete;
+    static BasicRevisionHeap borrowing(vector<Question>&&, EpochDay, pmr::memory_resource* = nullptr) = delete;
+
+    // Owned store: copies q in. Borrowed store: q must be an element of
+    // it (anything else throws invalid_argument). An id already queued
+    // is re-scored in place.
+    void push(const Question& x, EpochDay today) {
+        pushKeyed(x, x.getPriorityScore(today));
+    }
+
+    void push(const Question& x, const string& today) {
+        push(x, EpochDay::parse(today));
+    }
+
+    // ── Explicit keys — for callers that order by something other than
+    //    one day's score (see ParametricRevisionHeap) ──
+    void pushKeyed(const Question& x, double key) {
+        DSA_METRIC_ADD(HEAP_PUSH, 1);
+        DSA_METRIC_TIMER(HEAP_PUSH_NS);
+        enqueue(admit(x), key, true);
+    }
+
+    // borrowed store only: replace the contents with every store question
+    // keyOf accepts — bool keyOf(const Question&, double& key) — in O(n)
+    template <typename KeyFn>
+    void rebuildKeyed(KeyFn&& keyOf) {
+        if (!borrowing_) throw logic_error("RevisionHeap::rebuildKeyed() — needs a borrowed store!");
+        while (!empty()) {
+            Node n = detach(size() - 1);
+            eraseId(n.handle);
+        }
+        buildFrom(borrowedCount_, keyOf);
     }
 
     HeapEntry pop() {
-        if (heap_.empty()) throw runtime_error("RevisionHeap::pop() — empty!");
-        HeapEntry top = heap_[0];
-        heap_[0] = heap_.back();
-        heap_.pop_back();
-        if (!heap_.empty()) siftDown(0);
-        return top;
+        if (empty()) throw runtime_error("RevisionHeap::pop() — empty!");
+        DSA_METRIC_ADD(HEAP_POP, 1);
+        DSA_METRIC_TIMER(HEAP_POP_NS);
+        Node n = detach(0);
+        eraseId(n.handle);
+        HeapEntry out = borrowing_ ? HeapEntry(borrowed_[n.handle], n.score)
+                                   : HeapEntry(move(owned_[n.handle]), n.score);
+        releaseHandle(n.handle);
+        return out;
+    }
+
+    // pop() without the copy — for callers that already read top()
+    void discardTop() {
+        if (empty()) throw runtime_error("RevisionHeap::discardTop() — empty!");
+        DSA_METRIC_ADD(HEAP_POP, 1);
+        DSA_METRIC_TIMER(HEAP_POP_NS);
+        removeHandle(st_.handle(0));
+    }
+
+    HeapRef top() const {
+        if (empty()) throw runtime_error("RevisionHeap::top() — empty!");
+        return {q(st_.handle(0)), st_.key(0)};
     }
 
-    const HeapEntry& top() const {
-        if (heap_.empty()) throw runtime_error("RevisionHeap::top() — empty!");
-        return heap_[0];
+    // ── Handle access ──
+    Handle topHandle() const {
+        if (empty()) throw runtime_error("RevisionHeap::topHandle() — empty!");
+        return st_.handle(0);
     }
+    const Question& question(Handle h) const { return q(h); }
+    bool borrowsStore() const { return borrowing_; }
 
+    bool contains(const string& qid) const { return findId(qid) != NIL; }
+
+    // by identity for a borrowed store's own elements (no hashing), else by id
+    bool containsQuestion(const Question& x) const {
+        Handle h = handleOf(x);
+        return h != NIL ? pos_[h] != NIL : findId(x.id) != NIL;
+    }
+
+    // ── Indexed remove / re-score — O(log n) ──
     bool remove(const string& qid) {
-        for (int i = 0; i < static_cast<int>(heap_.size()); ++i)
-            if (heap_[i].question.id == qid) {
-                heap_[i] = heap_.back();
-                heap_.pop_back();
-                if (i < static_cast<int>(heap_.size())) { siftDown(i); siftUp(i); }
-                return true;
-            }
-        return false;
+        Handle h = findId(qid);
+        if (h == NIL) return false;
+        removeHandle(h);
+        return true;
     }
 
-    void updatePriority(const string& qid, const Question& updated, const string& today) {
-        for (int i = 0; i < static_cast<int>(heap_.size()); ++i)
-            if (heap_[i].question.id == qid) {
-                heap_[i].question = updated;
-                heap_[i].priorityScore = updated.getPriorityScore(today);
-                siftDown(i); siftUp(i);
-                return;
-            }
+    // decrease- or increase-key; pushes the question if it isn't queued.
+    // With a borrowed store, `updated` must be the store's element (edit
+    // it in place, then call this).
+    void updatePriority(const string& qid, const Question& updated, EpochDay today) {
+        Handle h = findId(qid);
+        if (h != NIL && updated.id != qid) removeHandle(h);     // re-keyed: drop the old id
         push(updated, today);
     }
 
-    // Top-K most urgent — O(k log n)
-    vector<HeapEntry> topK(int k) {
-        vector<HeapEntry> result, backup;
-        int cnt = min(k, static_cast<int>(heap_.size()));
-        for (int i = 0; i < cnt; ++i) {
-            HeapEntry e = pop();
-            result.push_back(e);
-            backup.push_back(e);
+    void updatePriority(const string& qid, const Question& updated, const string& today) {
+        updatePriority(qid, updated, EpochDay::parse(today));
+    }
+
+    // ── Top-K most urgent — O(k·d log k), read-only ──
+    // Best-first walk: a frontier min-heap of array indices starts at the
+    // root; each step emits its best node and admits that node's children.
+    // The frontier never exceeds k·(d − 1) + 1 entries, so small k needs
+    // no allocation. Visits in order of increasing score.
+    static constexpr int TOPK_INLINE = 128;
+
+    template <typename Fn>      // fn(const Question&, double score)
+    void forEachTop(int k, Fn&& fn) const {
+        int n = static_cast<int>(st_.size());
+        int cnt = min(k, n);
+        if (cnt <= 0) return;
+
+        int need = cnt * (Arity - 1) + 1;
+        uint32_t inlineBuf[TOPK_INLINE];
+        vector<uint32_t> spill;
+        uint32_t* frontier = inlineBuf;
+        if (need > TOPK_INLINE) { spill.resize(need); frontier = spill.data(); }
+
+        auto after = [&](uint32_t a, uint32_t b) { return st_.key(a) > st_.key(b); };
+        int fsize = 0;
+        frontier[fsize++] = 0;
+        for (int emitted = 0; emitted < cnt; ++emitted) {
+            pop_heap(frontier, frontier + fsize, after);
+            uint32_t i = frontier[--fsize];
+            fn(q(st_.handle(i)), st_.key(i));
+            int first = firstChild(static_cast<int>(i));
+            for (int c = first; c < first + Arity && c < n; ++c) {
+                frontier[fsize++] = static_cast<uint32_t>(c);
+                push_heap(frontier, frontier + fsize, after);
+            }
         }
-        for (auto& e : backup) heap_.push_back(e);
-        for (int i = static_cast<int>(heap_.size()) / 2 - 1; i >= 0; --i)
-            siftDown(i);
+    }
+
+    vector<HeapEntry> topK(int k) const {
+        vector<HeapEntry> result;
+        result.reserve(static_cast<size_t>(max(0, min(k, size()))));
+        forEachTop(k, [&](const Question& x, double score) { result.emplace_back(x, score); });
         return result;
     }
 
-    bool empty() const { return heap_.empty(); }
-    int  size()  const { return static_cast<int>(heap_.size()); }
+    bool empty() const { return st_.size() == 0; }
+    int  size()  const { return static_cast<int>(st_.size()); }
+
+    // bytes held by the heap itself (owned questions counted shallowly)
+    size_t memoryBytes() const {
+        return st_.bytes() + pos_.capacity() * sizeof(uint32_t)
+             + ids_.capacity() * sizeof(Handle) + freeHandles_.capacity() * sizeof(Handle)
+             + owned_.size() * sizeof(Question);
+    }
 
     bool isValidHeap() const {
-        int n = static_cast<int>(heap_.size());
+        int n = static_cast<int>(st_.size());
+        if (idCount_ != st_.size()) return false;
         for (int i = 0; i < n; ++i) {
-            int l = leftChild(i), r = rightChild(i);
-            if (l < n && heap_[l] < heap_[i]) return false;
-            if (r < n && heap_[r] < heap_[i]) return false;
+            if (i > 0 && st_.key(i) < st_.key(parent(i))) return false;
+            if (pos_[st_.handle(i)] != static_cast<uint32_t>(i)) return false;
         }
         return true;
     }
@@ -148,16 +668,24 @@ public:
         cout << "\n╔══════════════════════════════════════════╗\n"
              << "║     REVISION PRIORITY QUEUE (Min-Heap)   ║\n"
              << "╠══════════════════════════════════════════╣\n";
-        for (int i = 0; i < static_cast<int>(heap_.size()); ++i)
+        for (int i = 0; i < size(); ++i) {
+            const Question& x = q(st_.handle(i));
             cout << "║ [" << i << "] Score: "
-                 << fixed << setprecision(2) << heap_[i].priorityScore
-                 << " | " << heap_[i].question.name
-                 << " (" << difficultyToString(heap_[i].question.difficulty) << ")\n";
+                 << fixed << setprecision(2) << st_.key(i)
+                 << " | " << x.name
+                 << " (" << difficultyToString(x.difficulty) << ")\n";
+        }
         cout << "╚══════════════════════════════════════════╝\n"
              << "Heap valid: " << (isValidHeap() ? "YES" : "NO") << "\n";
     }
 };
 
+using RevisionHeap       = BasicRevisionHeap<>;
+using RevisionHeap4      = BasicRevisionHeap<4>;
+using RevisionHeap8      = BasicRevisionHeap<8>;
+using RevisionHeap4Split = BasicRevisionHeap<4, HeapLayout::SPLIT_KEYS>;
+using RevisionHeap8Split = BasicRevisionHeap<8, HeapLayout::SPLIT_KEYS>;
+
 } // namespace dsa
 
 #endif // REVISION_HEAP_H
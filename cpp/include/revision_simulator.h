@@ -0,0 +1,220 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Fast-Forward Revision Simulator
+
+   Replays the SM-2 schedule day by day on a virtual clock to predict
+   review load: each simulated day pulls the questions due, draws a
+   recall quality from a pluggable model, calls
+   RevisionEngine::completeRevision with the virtual date, and files
+   the question under its new due day.
+
+   Due questions live in one bucket per simulated day (calendar
+   queue), so a day costs O(reviews that day) — no scanning of the
+   whole deck and no wall-clock reads.
+
+   Time:  O(n + total reviews)     Space: O(n + days)
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef REVISION_SIMULATOR_H
+#define REVISION_SIMULATOR_H
+
+#include "dsa_core.h"
+#include "revision_engine.h"
+#include <random>
+#include <functional>
+
+using namespace std;
+
+namespace dsa {
+
+// ── Injectable clock ──
+
+class VirtualClock {
+private:
+    EpochDay day_;
+
+public:
+    explicit VirtualClock(EpochDay start = EpochDay::today()) : day_(start) {}
+
+    EpochDay today() const { return day_; }
+    void advance(int days = 1) { day_ = day_ + days; }
+};
+
+// ── Default recall model ──
+//
+//   P(recall) = base[difficulty] + easeWeight × (EF − 2.5)
+//             − overduePenalty × daysOverdue, clamped to [minRecall, 0.99]
+//   success → quality 3..5 (5 more likely at high EF), failure → 0..2
+
+struct RecallModel {
+    double baseRecall[3]  = { 0.95, 0.88, 0.78 };   // EASY, MEDIUM, HARD
+    double easeWeight     = 0.08;
+    double overduePenalty = 0.01;
+    double minRecall      = 0.05;
+
+    int operator()(const Question& q, EpochDay today, mt19937_64& rng) const {
+        double p = baseRecall[static_cast<int>(q.difficulty)]
+                 + easeWeight * (q.easeFactor - 2.5)
+                 - overduePenalty * max(0, today - q.nextRevisionDate);
+        p = max(minRecall, min(0.99, p));
+
+        uniform_real_distribution<double> u(0.0, 1.0);
+        double r = u(rng);
+        if (r < p) {
+            double strength = r / p;                  // lower = easier recall
+            return strength < 0.4 ? 5 : strength < 0.8 ? 4 : 3;
+        }
+        return static_cast<int>(3.0 * (r - p) / (1.0 - p + 1e-12));   // 0..2
+    }
+};
+
+// ── Configuration / per-day output ──
+
+struct SimulationConfig {
+    using QualityFn = function<int(const Question&, EpochDay, mt19937_64&)>;
+
+    EpochDay  start;          // first simulated day (default: today)
+    int       days;           // horizon
+    int       dailyLimit;     // max reviews per day, 0 = unlimited; the rest carries over
+    uint64_t  seed;
+    QualityFn quality;        // empty → RecallModel{}
+
+    SimulationConfig()
+        : start(EpochDay::today()), days(365), dailyLimit(0), seed(1) {}
+};
+
+struct SimulatedDay {
+    EpochDay  day;
+    int       due;            // scheduled for the day + carried over
+    int       reviewed;
+    int       carried;        // left for tomorrow by the daily limit
+    int       failed;         // quality < 3
+    int       mastered;       // became MASTERED that day
+    long long xp;
+};
+
+// ── Simulator ──
+
+class RevisionSimulator {
+private:
+    vector<Question>         deck_;
+    SimulationConfig         cfg_;
+    VirtualClock             clock_;
+    mt19937_64               rng_;
+    vector<vector<uint32_t>> buckets_;    // day offset → deck indices
+    vector<uint32_t>         carry_;
+    vector<SimulatedDay>     days_;
+    int                      beyondHorizon_;
+
+    void schedule(uint32_t idx) {
+        const Question& q = deck_[idx];
+        if (q.status == QuestionStatus::MASTERED || q.nextRevisionDate.empty()) return;
+        int offset = max(0, q.nextRevisionDate - cfg_.start);
+        if (offset >= cfg_.days) { beyondHorizon_++; return; }
+        buckets_[offset].push_back(idx);
+    }
+
+public:
+    RevisionSimulator(vector<Question> deck, SimulationConfig cfg = SimulationConfig())
+        : deck_(move(deck)), cfg_(move(cfg)), clock_(cfg_.start), rng_(cfg_.seed),
+          buckets_(max(0, cfg_.days)), beyondHorizon_(0) {
+        if (deck_.size() > UINT32_MAX)
+            throw invalid_argument("RevisionSimulator — deck too large!");
+        if (!cfg_.quality) cfg_.quality = RecallModel();
+        days_.reserve(buckets_.size());
+        for (uint32_t i = 0; i < deck_.size(); ++i) schedule(i);
+    }
+
+    bool done() const { return static_cast<int>(days_.size()) >= cfg_.days; }
+
+    // ── Simulate one day, then advance the clock ──
+    const SimulatedDay& step() {
+        if (done()) throw runtime_error("RevisionSimulator::step() — horizon reached!");
+        int offset = static_cast<int>(days_.size());
+        EpochDay today = clock_.today();
+
+        vector<uint32_t> work;
+        work.swap(carry_);
+        vector<uint32_t>& bucket = buckets_[offset];
+        work.insert(work.end(), bucket.begin(), bucket.end());
+        vector<uint32_t>().swap(bucket);      // release the day's storage
+
+        SimulatedDay d{today, static_cast<int>(work.size()), 0, 0, 0, 0, 0};
+        size_t limit = cfg_.dailyLimit > 0 ? static_cast<size_t>(cfg_.dailyLimit) : work.size();
+
+        for (size_t i = 0; i < work.size(); ++i) {
+            if (i >= limit) {
+                carry_.assign(work.begin() + static_cast<ptrdiff_t>(i), work.end());
+                d.carried = static_cast<int>(carry_.size());
+                break;
+            }
+            Question& q = deck_[work[i]];
+            int quality = cfg_.quality(q, today, rng_);
+            auto res = RevisionEngine::completeRevision(q, quality, 0, today);
+            d.reviewed++;
+            d.xp += res.xpAwarded;
+            if (res.wasReset) d.failed++;
+            if (res.newStatus == QuestionStatus::MASTERED) d.mastered++;
+            else schedule(work[i]);
+        }
+
+        days_.push_back(d);
+        clock_.advance();
+        return days_.back();
+    }
+
+    // ── Simulate the whole horizon ──
+    const vector<SimulatedDay>& run() {
+        while (!done()) step();
+        return days_;
+    }
+
+    const vector<SimulatedDay>& days()  const { return days_; }
+    const vector<Question>&     deck()  const { return deck_; }
+    const VirtualClock&         clock() const { return clock_; }
+    int beyondHorizon() const { return beyondHorizon_; }
+
+    long long totalReviews() const {
+        long long t = 0;
+        for (const auto& d : days_) t += d.reviewed;
+        return t;
+    }
+
+    long long totalXP() const {
+        long long t = 0;
+        for (const auto& d : days_) t += d.xp;
+        return t;
+    }
+
+    // ── Weekly roll-up of the simulated days ──
+    void printReport() const {
+        int peakDue = 0;
+        EpochDay peakDay;
+        for (const auto& d : days_)
+            if (d.due > peakDue) { peakDue = d.due; peakDay = d.day; }
+
+        cout << "\n╔══════════════════════════════════════════╗\n"
+             << "║     REVISION LOAD SIMULATION             ║\n"
+             << "╠══════════════════════════════════════════╣\n"
+             << "║ Questions: " << deck_.size() << " | Days: " << days_.size() << "\n"
+             << "║ Total reviews: " << totalReviews() << "\n"
+             << "║ Total XP: " << totalXP() << "\n"
+             << "║ Peak due: " << peakDue << " on " << peakDay << "\n"
+             << "║ Due after horizon: " << beyondHorizon_ + static_cast<int>(carry_.size()) << "\n"
+             << "╠══════════════════════════════════════════╣\n"
+             << "║ Week of       Due   Reviewed  Failed  XP\n";
+        for (size_t w = 0; w < days_.size(); w += 7) {
+            long long due = 0, rev = 0, fail = 0, xp = 0;
+            for (size_t i = w; i < min(days_.size(), w + 7); ++i) {
+                due += days_[i].due; rev += days_[i].reviewed;
+                fail += days_[i].failed; xp += days_[i].xp;
+            }
+            cout << "║ " << days_[w].day << "  " << setw(6) << due << "  " << setw(8) << rev
+                 << "  " << setw(6) << fail << "  " << xp << "\n";
+        }
+        cout << "╚══════════════════════════════════════════╝\n";
+    }
+};
+
+} // namespace dsa
+
+#endif // REVISION_SIMULATOR_H
@@ -3,12 +3,16 @@
    
    Merge Sort (stable), Quick Sort (randomized), Counting Sort,
    Insertion Sort (adaptive), Heap Sort, Smart Sort (auto-select)
+
+   With DSA_METRICS, comparisons and moves (element writes into the
+   array) are counted per call.
    ═══════════════════════════════════════════════════════════════════ */
 
 #ifndef SORTING_ENGINE_H
 #define SORTING_ENGINE_H
 
 #include "dsa_core.h"
+#include "metrics.h"
 #include <random>
 
 using namespace std;
@@ -45,7 +49,7 @@ namespace comparators {
         return a.dateSolved > b.dateSolved;
     }
     inline bool bySubjectThenDifficulty(const Question& a, const Question& b) {
-        if (a.subject != b.subject) return a.subject < b.subject;
+        if (a.subject != b.subject) return a.subject.str() < b.subject.str();
         return static_cast<int>(a.difficulty) < static_cast<int>(b.difficulty);
     }
 }
@@ -58,6 +62,9 @@ public:
 
     static void mergeSort(vector<Question>& arr, Comparator comp) {
         if (arr.size() <= 1) return;
+        DSA_METRIC_ADD(SORT_CALLS, 1);
+        DSA_METRIC_TIMER(SORT_NS);
+        DSA_METRIC_COUNT_CALLS(comp, SORT_COMPARISONS);
         mergeSortHelper(arr, 0, static_cast<int>(arr.size()) - 1, comp);
     }
 
@@ -74,6 +81,7 @@ private:
         vector<Question> left(arr.begin() + l, arr.begin() + m + 1);
         vector<Question> right(arr.begin() + m + 1, arr.begin() + r + 1);
         int i = 0, j = 0, k = l;
+        DSA_METRIC_ADD(SORT_MOVES, 2 * (r - l + 1));   // copy out + merge back
         while (i < static_cast<int>(left.size()) && j < static_cast<int>(right.size())) {
             if (comp(left[i], right[j]) || !comp(right[j], left[i]))
                 arr[k++] = left[i++];
@@ -89,6 +97,9 @@ public:
 
     static void quickSort(vector<Question>& arr, Comparator comp) {
         if (arr.size() <= 1) return;
+        DSA_METRIC_ADD(SORT_CALLS, 1);
+        DSA_METRIC_TIMER(SORT_NS);
+        DSA_METRIC_COUNT_CALLS(comp, SORT_COMPARISONS);
         quickSortHelper(arr, 0, static_cast<int>(arr.size()) - 1, comp);
     }
 
@@ -109,6 +120,7 @@ private:
         for (int j = lo; j < hi; ++j)
             if (comp(arr[j], arr[hi])) swap(arr[++i], arr[j]);
         swap(arr[i + 1], arr[hi]);
+        DSA_METRIC_ADD(SORT_MOVES, 2 * (i - lo + 3));   // two writes per swap
         return i + 1;
     }
 
@@ -118,6 +130,7 @@ private:
             int j = i - 1;
             while (j >= lo && comp(key, arr[j])) { arr[j + 1] = arr[j]; --j; }
             arr[j + 1] = key;
+            DSA_METRIC_ADD(SORT_MOVES, i - j);
         }
     }
 
@@ -125,6 +138,9 @@ public:
     // ═══════ 3. COUNTING SORT — O(n + k) by difficulty ═══════
 
     static void countingSortByDifficulty(vector<Question>& arr) {
+        DSA_METRIC_ADD(SORT_CALLS, 1);
+        DSA_METRIC_TIMER(SORT_NS);
+        DSA_METRIC_ADD(SORT_MOVES, arr.size());
         const int K = 3;
         vector<int> count(K, 0);
         for (const auto& q : arr) count[static_cast<int>(q.difficulty)]++;
@@ -142,11 +158,15 @@ public:
     // ═══════ 4. INSERTION SORT — O(n²), adaptive ═══════
 
     static void insertionSort(vector<Question>& arr, Comparator comp) {
+        DSA_METRIC_ADD(SORT_CALLS, 1);
+        DSA_METRIC_TIMER(SORT_NS);
+        DSA_METRIC_COUNT_CALLS(comp, SORT_COMPARISONS);
         for (int i = 1; i < static_cast<int>(arr.size()); ++i) {
             Question key = arr[i];
             int j = i - 1;
             while (j >= 0 && comp(key, arr[j])) { arr[j + 1] = arr[j]; --j; }
             arr[j + 1] = key;
+            DSA_METRIC_ADD(SORT_MOVES, i - j);
         }
     }
 
@@ -155,8 +175,12 @@ public:
     static void heapSort(vector<Question>& arr, Comparator comp) {
         int n = static_cast<int>(arr.size());
         if (n <= 1) return;
+        DSA_METRIC_ADD(SORT_CALLS, 1);
+        DSA_METRIC_TIMER(SORT_NS);
+        DSA_METRIC_COUNT_CALLS(comp, SORT_COMPARISONS);
         for (int i = n / 2 - 1; i >= 0; --i) heapify(arr, n, i, comp);
         for (int i = n - 1; i > 0; --i) { swap(arr[0], arr[i]); heapify(arr, i, 0, comp); }
+        DSA_METRIC_ADD(SORT_MOVES, 2 * (n - 1));
     }
 
 private:
@@ -164,7 +188,11 @@ private:
         int largest = root, l = 2 * root + 1, r = 2 * root + 2;
         if (l < sz && comp(arr[largest], arr[l])) largest = l;
         if (r < sz && comp(arr[largest], arr[r])) largest = r;
-        if (largest != root) { swap(arr[root], arr[largest]); heapify(arr, sz, largest, comp); }
+        if (largest != root) {
+            swap(arr[root], arr[largest]);
+            DSA_METRIC_ADD(SORT_MOVES, 2);
+            heapify(arr, sz, largest, comp);
+        }
     }
 
 public:
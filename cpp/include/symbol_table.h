@@ -0,0 +1,235 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — String Interner (Symbol Table)
+
+   Maps each distinct string (subject, platform, tag) to a small dense
+   integer id. Questions carry 4-byte Symbols instead of heap strings,
+   equality is an integer compare, and grouping by topic becomes plain
+   array indexing by Symbol::id.
+
+   Storage : chunked string slabs (never move) + hash index of views
+   Time:  intern → O(L) avg (locked)  |  str(id) → O(1), lock-free
+   Space: O(total distinct characters)
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef SYMBOL_TABLE_H
+#define SYMBOL_TABLE_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <initializer_list>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+using namespace std;
+
+namespace dsa {
+
+class SymbolTable {
+public:
+    static constexpr uint32_t NONE       = UINT32_MAX;
+    static constexpr uint32_t CHUNK_BITS = 12;
+    static constexpr uint32_t CHUNK_SIZE = 1u << CHUNK_BITS;
+    static constexpr uint32_t MAX_CHUNKS = 4096;   // 16M symbols
+
+private:
+    mutable shared_mutex                   mu_;
+    unordered_map<string_view, uint32_t>   index_;   // views into chunks_
+    array<atomic<string*>, MAX_CHUNKS>     chunks_;
+    atomic<uint32_t>                       size_;
+
+    uint32_t findLocked(string_view s) const {
+        auto it = index_.find(s);
+        return it == index_.end() ? NONE : it->second;
+    }
+
+public:
+    SymbolTable() : size_(0) {
+        for (auto& c : chunks_) c.store(nullptr, memory_order_relaxed);
+        intern("");   // id 0 is always the empty string
+    }
+
+    ~SymbolTable() {
+        for (auto& c : chunks_) delete[] c.load(memory_order_relaxed);
+    }
+
+    SymbolTable(const SymbolTable&)            = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    // ── Intern — returns the existing id or assigns the next one ──
+    uint32_t intern(string_view s) {
+        {
+            shared_lock<shared_mutex> rd(mu_);
+            uint32_t id = findLocked(s);
+            if (id != NONE) return id;
+        }
+        unique_lock<shared_mutex> wr(mu_);
+        uint32_t id = findLocked(s);
+        if (id != NONE) return id;
+
+        id = size_.load(memory_order_relaxed);
+        if ((id >> CHUNK_BITS) >= MAX_CHUNKS)
+            throw length_error("SymbolTable::intern() — table full!");
+
+        auto&   slot  = chunks_[id >> CHUNK_BITS];
+        string* chunk = slot.load(memory_order_relaxed);
+        if (!chunk) {
+            chunk = new string[CHUNK_SIZE];
+            slot.store(chunk, memory_order_release);
+        }
+        string& stored = chunk[id & (CHUNK_SIZE - 1)];
+        stored.assign(s.data(), s.size());
+        index_.emplace(string_view(stored), id);
+        size_.store(id + 1, memory_order_release);
+        return id;
+    }
+
+    // ── Lookup without inserting — NONE if never interned ──
+    uint32_t find(string_view s) const {
+        shared_lock<shared_mutex> rd(mu_);
+        return findLocked(s);
+    }
+
+    // ── Reverse lookup — O(1), no locking ──
+    const string& str(uint32_t id) const {
+        return chunks_[id >> CHUNK_BITS].load(memory_order_acquire)[id & (CHUNK_SIZE - 1)];
+    }
+
+    uint32_t size() const { return size_.load(memory_order_acquire); }
+};
+
+// process-wide table for subjects, platforms and tags
+inline SymbolTable& symbols() {
+    static SymbolTable table;
+    return table;
+}
+
+// ── Symbol — 4-byte handle to an interned string ──
+
+struct Symbol {
+    uint32_t id;
+
+    Symbol() : id(0) {}
+    Symbol(const string& s) : id(symbols().intern(s)) {}
+    Symbol(const char* s)   : id(symbols().intern(s)) {}
+
+    static Symbol fromId(uint32_t i) { Symbol s; s.id = i; return s; }
+    static Symbol intern(string_view s) { return fromId(symbols().intern(s)); }
+
+    // no insertion; the result compares unequal to every real symbol
+    static Symbol find(string_view s) { return fromId(symbols().find(s)); }
+
+    bool valid() const { return id != SymbolTable::NONE; }
+    bool empty() const { return id == 0; }
+
+    const string& str() const {
+        static const string none;
+        return valid() ? symbols().str(id) : none;
+    }
+
+    bool operator==(Symbol o) const { return id == o.id; }
+    bool operator!=(Symbol o) const { return id != o.id; }
+    bool operator< (Symbol o) const { return id <  o.id; }
+};
+
+inline ostream& operator<<(ostream& os, Symbol s) {
+    return os << s.str();
+}
+
+// ── SymbolList — small-buffer array of Symbols (tags) ──
+//
+//   Up to INLINE symbols live inside the object (no allocation);
+//   longer lists spill to a heap array.
+
+class SymbolList {
+public:
+    static constexpr uint32_t INLINE = 6;
+
+private:
+    uint32_t size_;
+    uint32_t cap_;
+    union Storage {
+        Symbol  inl[INLINE];
+        Symbol* heap;
+        Storage() : inl{} {}
+    } s_;
+
+    bool onHeap() const { return cap_ > INLINE; }
+
+    void grow() {
+        uint32_t newCap = cap_ * 2;
+        Symbol* p = new Symbol[newCap];
+        memcpy(static_cast<void*>(p), data(), size_ * sizeof(Symbol));
+        if (onHeap()) delete[] s_.heap;
+        s_.heap = p;
+        cap_ = newCap;
+    }
+
+public:
+    SymbolList() : size_(0), cap_(INLINE) {}
+
+    SymbolList(initializer_list<Symbol> il) : SymbolList() {
+        for (Symbol s : il) push_back(s);
+    }
+
+    SymbolList(const vector<string>& strs) : SymbolList() {
+        for (const auto& s : strs) push_back(Symbol(s));
+    }
+
+    SymbolList(const SymbolList& o) : SymbolList() {
+        for (Symbol s : o) push_back(s);
+    }
+
+    SymbolList(SymbolList&& o) noexcept : size_(o.size_), cap_(o.cap_), s_(o.s_) {
+        o.size_ = 0;
+        o.cap_  = INLINE;
+    }
+
+    SymbolList& operator=(SymbolList o) noexcept {
+        swap(size_, o.size_);
+        swap(cap_,  o.cap_);
+        swap(s_,    o.s_);
+        return *this;
+    }
+
+    ~SymbolList() { if (onHeap()) delete[] s_.heap; }
+
+    void push_back(Symbol s) {
+        if (size_ == cap_) grow();
+        data()[size_++] = s;
+    }
+
+    void clear() { size_ = 0; }
+
+    bool contains(Symbol s) const {
+        for (Symbol t : *this) if (t == s) return true;
+        return false;
+    }
+
+    const Symbol* data()  const { return onHeap() ? s_.heap : s_.inl; }
+    Symbol*       data()        { return onHeap() ? s_.heap : s_.inl; }
+    const Symbol* begin() const { return data(); }
+    const Symbol* end()   const { return data() + size_; }
+
+    Symbol   operator[](size_t i) const { return data()[i]; }
+    uint32_t size()  const { return size_; }
+    bool     empty() const { return size_ == 0; }
+
+    vector<string> toStrings() const {
+        vector<string> out;
+        out.reserve(size_);
+        for (Symbol s : *this) out.push_back(s.str());
+        return out;
+    }
+};
+
+} // namespace dsa
+
+#endif // SYMBOL_TABLE_H
@@ -2,6 +2,7 @@
    DSA Tracker — DAG for Topic Dependencies
    
    Algorithms: BFS, DFS, Topological Sort (Kahn + DFS), Shortest Path
+   Vertices  : dense indices keyed by interned topic Symbols
    Time: O(V + E) for all traversals
    ═══════════════════════════════════════════════════════════════════ */
 
@@ -9,11 +10,9 @@
 #define TOPIC_GRAPH_H
 
 #include "dsa_core.h"
-#include <unordered_map>
-#include <unordered_set>
+#include "metrics.h"
 #include <queue>
 #include <stack>
-#include <set>
 
 using namespace std;
 
@@ -21,171 +20,216 @@ namespace dsa {
 
 class TopicGraph {
 private:
-    unordered_map<string, vector<string>> adj_;
-    unordered_map<string, vector<string>> revAdj_;
-    unordered_map<string, Topic>          topics_;
-    unordered_map<string, int>            inDeg_;
-
-    bool topSortDFS(const string& v, unordered_set<string>& visited,
-                    unordered_set<string>& inStack, stack<string>& result) const {
-        visited.insert(v);
-        inStack.insert(v);
-        auto it = adj_.find(v);
-        if (it != adj_.end())
-            for (const auto& nb : it->second) {
-                if (inStack.count(nb)) return false;
-                if (!visited.count(nb))
-                    if (!topSortDFS(nb, visited, inStack, result)) return false;
-            }
-        inStack.erase(v);
-        result.push(v);
+    // vertices are dense indices; topic names are interned Symbols
+    vector<int>          vertexOf_;   // Symbol::id → vertex (-1 = absent)
+    vector<Symbol>       names_;      // vertex → Symbol
+    vector<vector<int>>  adj_;
+    vector<vector<int>>  revAdj_;
+    vector<Topic>        topics_;
+    vector<int>          inDeg_;
+
+    int vertex(Symbol s) const {
+        return (s.valid() && s.id < vertexOf_.size()) ? vertexOf_[s.id] : -1;
+    }
+
+    int vertex(const string& name) const { return vertex(Symbol::find(name)); }
+
+    int addVertex(Symbol s) {
+        if (s.id >= vertexOf_.size()) vertexOf_.resize(s.id + 1, -1);
+        if (vertexOf_[s.id] < 0) {
+            vertexOf_[s.id] = static_cast<int>(names_.size());
+            names_.push_back(s);
+            adj_.emplace_back();
+            revAdj_.emplace_back();
+            topics_.emplace_back(s.str());
+            inDeg_.push_back(0);
+        }
+        return vertexOf_[s.id];
+    }
+
+    const string& nameOf(int v) const { return names_[v].str(); }
+
+    static void recordTraversal(size_t nodes, size_t edges) {
+        DSA_METRIC_ADD(GRAPH_TRAVERSALS, 1);
+        DSA_METRIC_ADD(GRAPH_NODES_EXPANDED, nodes);
+        DSA_METRIC_ADD(GRAPH_EDGES_SCANNED, edges);
+        DSA_METRIC_RECORD(GRAPH_NODES_PER_TRAVERSAL, nodes);
+    }
+
+    bool topSortDFS(int v, vector<char>& visited, vector<char>& inStack,
+                    vector<int>& result, size_t& edges) const {
+        visited[v] = 1;
+        inStack[v] = 1;
+        edges += adj_[v].size();
+        for (int nb : adj_[v]) {
+            if (inStack[nb]) return false;
+            if (!visited[nb])
+                if (!topSortDFS(nb, visited, inStack, result, edges)) return false;
+        }
+        inStack[v] = 0;
+        result.push_back(v);
         return true;
     }
 
 public:
     TopicGraph() = default;
 
-    void addTopic(const string& name) {
-        if (topics_.find(name) == topics_.end()) {
-            topics_[name] = Topic(name);
-            adj_[name];
-            revAdj_[name];
-            inDeg_[name] = 0;
-        }
-    }
+    void addTopic(const string& name) { addVertex(Symbol(name)); }
 
     void addPrerequisite(const string& prereq, const string& topic) {
-        addTopic(prereq);
-        addTopic(topic);
-        adj_[prereq].push_back(topic);
-        revAdj_[topic].push_back(prereq);
-        inDeg_[topic]++;
+        int p = addVertex(Symbol(prereq));
+        int t = addVertex(Symbol(topic));
+        adj_[p].push_back(t);
+        revAdj_[t].push_back(p);
+        inDeg_[t]++;
     }
 
     // ── BFS — level-order traversal — O(V + E) ──
     vector<vector<string>> bfs(const string& start) const {
         vector<vector<string>> levels;
-        if (adj_.find(start) == adj_.end()) return levels;
+        int s = vertex(start);
+        if (s < 0) return levels;
 
-        unordered_set<string> visited;
-        queue<string> q;
-        q.push(start);
-        visited.insert(start);
+        DSA_METRIC_TIMER(GRAPH_TRAVERSAL_NS);
+        vector<char> visited(names_.size(), 0);
+        queue<int> q;
+        q.push(s);
+        visited[s] = 1;
+        size_t nodes = 0, edges = 0;
 
         while (!q.empty()) {
             int sz = static_cast<int>(q.size());
             vector<string> level;
             for (int i = 0; i < sz; ++i) {
-                string cur = q.front(); q.pop();
-                level.push_back(cur);
-                auto it = adj_.find(cur);
-                if (it != adj_.end())
-                    for (const auto& nb : it->second)
-                        if (!visited.count(nb)) { visited.insert(nb); q.push(nb); }
+                int cur = q.front(); q.pop();
+                level.push_back(nameOf(cur));
+                ++nodes;
+                edges += adj_[cur].size();
+                for (int nb : adj_[cur])
+                    if (!visited[nb]) { visited[nb] = 1; q.push(nb); }
             }
             levels.push_back(level);
         }
+        recordTraversal(nodes, edges);
         return levels;
     }
 
     // ── DFS — deep exploration — O(V + E) ──
     vector<string> dfs(const string& start) const {
         vector<string> result;
-        if (adj_.find(start) == adj_.end()) return result;
+        int s = vertex(start);
+        if (s < 0) return result;
 
-        unordered_set<string> visited;
-        stack<string> st;
-        st.push(start);
+        DSA_METRIC_TIMER(GRAPH_TRAVERSAL_NS);
+        vector<char> visited(names_.size(), 0);
+        stack<int> st;
+        st.push(s);
+        size_t edges = 0;
 
         while (!st.empty()) {
-            string cur = st.top(); st.pop();
-            if (visited.count(cur)) continue;
-            visited.insert(cur);
-            result.push_back(cur);
-            auto it = adj_.find(cur);
-            if (it != adj_.end())
-                for (int i = static_cast<int>(it->second.size()) - 1; i >= 0; --i)
-                    if (!visited.count(it->second[i]))
-                        st.push(it->second[i]);
+            int cur = st.top(); st.pop();
+            if (visited[cur]) continue;
+            visited[cur] = 1;
+            result.push_back(nameOf(cur));
+            const auto& nbs = adj_[cur];
+            edges += nbs.size();
+            for (int i = static_cast<int>(nbs.size()) - 1; i >= 0; --i)
+                if (!visited[nbs[i]])
+                    st.push(nbs[i]);
         }
+        recordTraversal(result.size(), edges);
         return result;
     }
 
     // ── Topological Sort — Kahn's BFS — O(V + E) ──
     vector<string> topologicalSortKahn() const {
-        unordered_map<string, int> deg = inDeg_;
-        queue<string> q;
-        for (auto& kv : deg)
-            if (kv.second == 0) q.push(kv.first);
+        DSA_METRIC_TIMER(GRAPH_TRAVERSAL_NS);
+        vector<int> deg = inDeg_;
+        queue<int> q;
+        for (int v = 0; v < static_cast<int>(deg.size()); ++v)
+            if (deg[v] == 0) q.push(v);
 
         vector<string> order;
+        size_t edges = 0;
         while (!q.empty()) {
-            string cur = q.front(); q.pop();
-            order.push_back(cur);
-            auto it = adj_.find(cur);
-            if (it != adj_.end())
-                for (const auto& nb : it->second)
-                    if (--deg[nb] == 0) q.push(nb);
+            int cur = q.front(); q.pop();
+            order.push_back(nameOf(cur));
+            edges += adj_[cur].size();
+            for (int nb : adj_[cur])
+                if (--deg[nb] == 0) q.push(nb);
         }
+        recordTraversal(order.size(), edges);
         return order;
     }
 
     // ── Topological Sort — DFS with cycle detection — O(V + E) ──
     vector<string> topologicalSortDFS() const {
-        unordered_set<string> visited, inStack;
-        stack<string> result;
-        for (auto& kv : adj_)
-            if (!visited.count(kv.first))
-                if (!topSortDFS(kv.first, visited, inStack, result))
+        DSA_METRIC_TIMER(GRAPH_TRAVERSAL_NS);
+        int n = static_cast<int>(names_.size());
+        vector<char> visited(n, 0), inStack(n, 0);
+        vector<int> result;
+        size_t edges = 0;
+        for (int v = 0; v < n; ++v)
+            if (!visited[v])
+                if (!topSortDFS(v, visited, inStack, result, edges)) {
+                    recordTraversal(result.size(), edges);
                     return {};
+                }
+        recordTraversal(result.size(), edges);
         vector<string> order;
-        while (!result.empty()) { order.push_back(result.top()); result.pop(); }
+        for (auto it = result.rbegin(); it != result.rend(); ++it)
+            order.push_back(nameOf(*it));
         return order;
     }
 
     // ── Transitive prerequisites — BFS on reverse graph ──
     vector<string> getPrerequisites(const string& topic) const {
         vector<string> prereqs;
-        if (revAdj_.find(topic) == revAdj_.end()) return prereqs;
+        int t = vertex(topic);
+        if (t < 0) return prereqs;
+        DSA_METRIC_TIMER(GRAPH_TRAVERSAL_NS);
 
-        unordered_set<string> visited;
-        queue<string> q;
-        auto it = revAdj_.find(topic);
-        if (it != revAdj_.end())
-            for (const auto& p : it->second)
-                if (!visited.count(p)) { visited.insert(p); q.push(p); }
+        vector<char> visited(names_.size(), 0);
+        queue<int> q;
+        for (int p : revAdj_[t])
+            if (!visited[p]) { visited[p] = 1; q.push(p); }
 
+        size_t edges = revAdj_[t].size();
         while (!q.empty()) {
-            string cur = q.front(); q.pop();
-            prereqs.push_back(cur);
-            auto ri = revAdj_.find(cur);
-            if (ri != revAdj_.end())
-                for (const auto& p : ri->second)
-                    if (!visited.count(p)) { visited.insert(p); q.push(p); }
+            int cur = q.front(); q.pop();
+            prereqs.push_back(nameOf(cur));
+            edges += revAdj_[cur].size();
+            for (int p : revAdj_[cur])
+                if (!visited[p]) { visited[p] = 1; q.push(p); }
         }
+        recordTraversal(prereqs.size() + 1, edges);
         return prereqs;
     }
 
     // ── Shortest path (BFS unweighted) — O(V + E) ──
     int shortestPath(const string& from, const string& to) const {
         if (from == to) return 0;
-        if (adj_.find(from) == adj_.end() || adj_.find(to) == adj_.end()) return -1;
-
-        unordered_map<string, int> dist;
-        queue<string> q;
-        dist[from] = 0;
-        q.push(from);
+        int src = vertex(from), dst = vertex(to);
+        if (src < 0 || dst < 0) return -1;
+        DSA_METRIC_TIMER(GRAPH_TRAVERSAL_NS);
+
+        vector<int> dist(names_.size(), -1);
+        queue<int> q;
+        dist[src] = 0;
+        q.push(src);
+        size_t nodes = 0, edges = 0;
         while (!q.empty()) {
-            string cur = q.front(); q.pop();
-            if (cur == to) return dist[to];
-            auto it = adj_.find(cur);
-            if (it != adj_.end())
-                for (const auto& nb : it->second)
-                    if (dist.find(nb) == dist.end()) {
-                        dist[nb] = dist[cur] + 1;
-                        q.push(nb);
-                    }
+            int cur = q.front(); q.pop();
+            ++nodes;
+            if (cur == dst) { recordTraversal(nodes, edges); return dist[dst]; }
+            edges += adj_[cur].size();
+            for (int nb : adj_[cur])
+                if (dist[nb] < 0) {
+                    dist[nb] = dist[cur] + 1;
+                    q.push(nb);
+                }
         }
+        recordTraversal(nodes, edges);
         return -1;
     }
 
@@ -195,17 +239,17 @@ public:
 
     vector<string> getStartingTopics() const {
         vector<string> out;
-        for (auto& kv : inDeg_)
-            if (kv.second == 0) out.push_back(kv.first);
+        for (int v = 0; v < static_cast<int>(inDeg_.size()); ++v)
+            if (inDeg_[v] == 0) out.push_back(nameOf(v));
         sort(out.begin(), out.end());
         return out;
     }
 
     string getMostCriticalTopic() const {
         string best; int mx = -1;
-        for (auto& kv : adj_) {
-            int dep = static_cast<int>(kv.second.size());
-            if (dep > mx) { mx = dep; best = kv.first; }
+        for (int v = 0; v < static_cast<int>(adj_.size()); ++v) {
+            int dep = static_cast<int>(adj_[v].size());
+            if (dep > mx) { mx = dep; best = nameOf(v); }
         }
         return best;
     }
@@ -213,7 +257,7 @@ public:
     int getVertexCount() const { return static_cast<int>(topics_.size()); }
     int getEdgeCount() const {
         int c = 0;
-        for (auto& kv : adj_) c += static_cast<int>(kv.second.size());
+        for (const auto& nbs : adj_) c += static_cast<int>(nbs.size());
         return c;
     }
 
@@ -224,12 +268,12 @@ public:
              << "║ Vertices: " << getVertexCount()
              << " | Edges: " << getEdgeCount() << "\n"
              << "╠══════════════════════════════════════════╣\n";
-        for (auto& kv : adj_) {
-            cout << "║ " << kv.first << " -> ";
-            if (kv.second.empty()) cout << "(leaf)";
-            else for (int i = 0; i < static_cast<int>(kv.second.size()); ++i) {
+        for (int v = 0; v < static_cast<int>(adj_.size()); ++v) {
+            cout << "║ " << nameOf(v) << " -> ";
+            if (adj_[v].empty()) cout << "(leaf)";
+            else for (int i = 0; i < static_cast<int>(adj_[v].size()); ++i) {
                 if (i > 0) cout << ", ";
-                cout << kv.second[i];
+                cout << nameOf(adj_[v][i]);
             }
             cout << "\n";
         }
@@ -22,6 +22,7 @@
 #include "revision_engine.h"
 #include "gamification.h"
 #include "analytics_engine.h"
+#include "metrics.h"
 
 using namespace std;
 using namespace dsa;
@@ -43,9 +44,9 @@ vector<Question> createSampleQuestions() {
         q.difficulty = diff; q.status = status;
         q.easeFactor = ef; q.revisionCycle = cycle;
         q.streak = streak; q.xpEarned = xp;
-        q.dateSolved = solved;
-        q.nextRevisionDate = nextRev;
-        q.lastRevisionDate = lastRev;
+        q.dateSolved = EpochDay::parse(solved);
+        q.nextRevisionDate = EpochDay::parse(nextRev);
+        q.lastRevisionDate = EpochDay::parse(lastRev);
         q.tags = tags; q.platform = "LeetCode";
         return q;
     };
@@ -151,7 +152,7 @@ void demoHeap(const vector<Question>& questions) {
          << "║     DEMO 2: MIN-HEAP — Revision Priority Queue         ║\n"
          << "╚══════════════════════════════════════════════════════════╝\n";
 
-    string today = todayStr();
+    EpochDay today = EpochDay::today();
     RevisionHeap heap(questions, today);
     heap.print();
 
@@ -404,6 +405,8 @@ int main() {
     demoGamification(questions);
     demoAnalytics(questions);
 
+    if (MetricsRegistry::enabled()) metrics().printMetrics();
+
     cout << "\n\n═══════════════════════════════════════════════════════════\n"
          << "  ALL 8 DEMOS COMPLETED SUCCESSFULLY\n"
          << "  Data Structures: HashMap, MinHeap, Trie, DAG\n"
@@ -0,0 +1,183 @@
+/* ═══════════════════════════════════════════════════════════════════
+   RevisionCalendar — pop / drain order checked by brute force
+
+   A fixed store of questions is re-dated, pushed, removed, popped and
+   drained at random; every dequeue is compared with a linear scan for
+   the earliest (day, getPriorityScore(today)) among the queued ids.
+   Due days span the past, the wheel window and far beyond it, so the
+   overflow map and the cursor moves are exercised too.
+   ═══════════════════════════════════════════════════════════════════ */
+
+#include "revision_calendar.h"
+#include "test_check.h"
+#include <algorithm>
+#include <random>
+#include <set>
+
+using namespace std;
+using namespace dsa;
+
+namespace {
+
+const EpochDay BASE = EpochDay::fromCivil(2026, 1, 1);
+
+struct Fixture {
+    mt19937          rng;
+    vector<Question> store;      // never reallocates — the calendar keeps pointers
+    set<int>         queued;     // store indexes the calendar should hold
+
+    explicit Fixture(int n, unsigned seed) : rng(seed), store(n) {
+        for (int i = 0; i < n; ++i) {
+            store[i].id = "q" + to_string(i);
+            redate(store[i]);
+        }
+    }
+
+    // mostly near BASE, some past the wheel, some long overdue
+    void redate(Question& q) {
+        int r = static_cast<int>(rng() % 10);
+        int off = r < 6 ? static_cast<int>(rng() % 60) - 20
+                : r < 9 ? static_cast<int>(rng() % 3000)
+                :         -static_cast<int>(rng() % 2000);
+        q.nextRevisionDate = BASE + off;
+        q.difficulty = static_cast<Difficulty>(rng() % 3);
+        q.easeFactor = 1.3 + (rng() % 1000000) / 1e6;
+        q.streak     = static_cast<int>(rng() % 5);
+        q.status     = rng() % 20 == 0 ? QuestionStatus::MASTERED : QuestionStatus::SOLVED;
+    }
+
+    int indexOf(const Question& q) const { return static_cast<int>(&q - store.data()); }
+
+    pair<int32_t, double> key(int i, EpochDay today) const {
+        return {store[i].nextRevisionDate.days, store[i].getPriorityScore(today)};
+    }
+
+    // queued index with the smallest key, or -1
+    int expectedFront(EpochDay today, EpochDay dueBy = EpochDay(INT32_MAX)) const {
+        int best = -1;
+        for (int i : queued) {
+            if (store[i].nextRevisionDate > dueBy) continue;
+            if (best < 0 || key(i, today) < key(best, today)) best = i;
+        }
+        return best;
+    }
+};
+
+// ── Random push / remove / pop / drain ──
+void testRandomOps() {
+    Fixture f(3000, 11);
+    RevisionCalendar cal;
+    for (int i = 0; i < 3000; ++i)
+        if (cal.push(&f.store[i])) f.queued.insert(i);
+
+    EpochDay today = BASE;
+    for (int step = 0; step < 20000; ++step) {
+        int op = static_cast<int>(f.rng() % 10);
+        int i  = static_cast<int>(f.rng() % f.store.size());
+
+        if (op < 4) {
+            f.redate(f.store[i]);
+            bool want = f.store[i].status != QuestionStatus::MASTERED;
+            CHECK(cal.push(&f.store[i]) == want);
+            if (want) f.queued.insert(i); else f.queued.erase(i);
+        } else if (op < 6) {
+            bool had = f.queued.erase(i) > 0;
+            CHECK(cal.remove(f.store[i].id) == had);
+        } else if (op < 9) {
+            if (f.queued.empty()) continue;
+            int want = f.expectedFront(today);
+            int got  = f.indexOf(cal.pop(today));
+            CHECK(f.queued.count(got) == 1);
+            CHECK(f.key(got, today) == f.key(want, today));     // equal keys may leave in either order
+            f.queued.erase(got);
+        } else {
+            EpochDay dueBy = BASE + (static_cast<int>(f.rng() % 200) - 50);
+            for (const Question* q : cal.drainDueBy(dueBy)) {
+                int want = f.expectedFront(dueBy, dueBy);
+                int got  = f.indexOf(*q);
+                CHECK(want >= 0 && f.queued.count(got) == 1);
+                if (want >= 0) CHECK(f.key(got, dueBy) == f.key(want, dueBy));
+                f.queued.erase(got);
+            }
+            CHECK(f.expectedFront(dueBy, dueBy) < 0);
+            today = dueBy;
+        }
+        CHECK(cal.size() == f.queued.size());
+    }
+
+    // fn may re-file what it is handed; past dueBy it is not drained again
+    EpochDay end = BASE + 100000;
+    size_t drained = cal.drainDueBy(end, [&](const Question& q) {
+        Question& m = f.store[f.indexOf(q)];
+        m.nextRevisionDate = end + 1;
+        cal.push(&m);
+    });
+    CHECK(drained == f.queued.size());
+    CHECK(cal.size() == f.queued.size());
+    for (int i : f.queued) CHECK(cal.contains(f.store[i].id));
+    CHECK(cal.nextDueDay() == (f.queued.empty() ? EpochDay() : end + 1));
+}
+
+// ── Deck constructor = pushing every question ──
+void testDeckBuild() {
+    Fixture f(3000, 22);
+    RevisionCalendar built(f.store), pushed;
+    for (const auto& q : f.store) pushed.push(&q);
+    CHECK(built.size() == pushed.size());
+
+    // only days a full window past the earliest one may overflow
+    int32_t first = INT32_MAX;
+    for (const auto& q : f.store)
+        if (q.status != QuestionStatus::MASTERED) first = min(first, q.nextRevisionDate.days);
+    set<int32_t> beyond;
+    for (const auto& q : f.store)
+        if (q.status != QuestionStatus::MASTERED && q.nextRevisionDate.days >= first + RevisionCalendar::WHEEL_DAYS)
+            beyond.insert(q.nextRevisionDate.days);
+    CHECK(built.overflowDays() == beyond.size());
+
+    EpochDay today = BASE + 30;
+    while (!built.empty() && !pushed.empty()) {
+        int a = f.indexOf(built.pop(today));
+        int b = f.indexOf(pushed.pop(today));
+        CHECK(f.key(a, today) == f.key(b, today));
+    }
+    CHECK(built.empty() && pushed.empty());
+}
+
+// ── A deck that fits the wheel leaves the overflow map empty ──
+void testDeckFitsWheel() {
+    mt19937 rng(33);
+    vector<Question> deck(5000);
+    for (size_t i = 0; i < deck.size(); ++i) {
+        deck[i].id = "q" + to_string(i);
+        deck[i].status = QuestionStatus::SOLVED;
+        deck[i].nextRevisionDate = BASE + static_cast<int>(i % RevisionCalendar::WHEEL_DAYS);
+    }
+    shuffle(deck.begin(), deck.end(), rng);       // earliest day not first in the deck
+    deck.push_back(deck[7]);                      // a repeated id keeps the last copy
+    deck.back().nextRevisionDate = BASE + 3;
+
+    RevisionCalendar cal(deck);
+    CHECK(cal.size() == 5000);
+    CHECK(cal.overflowDays() == 0);
+    CHECK(cal.nextDueDay() == BASE);
+
+    size_t n = 0;
+    int32_t last = BASE.days;
+    for (const Question* q : cal.drainDueBy(BASE + RevisionCalendar::WHEEL_DAYS)) {
+        CHECK(q->nextRevisionDate.days >= last);
+        last = q->nextRevisionDate.days;
+        CHECK(q != &deck[7]);
+        ++n;
+    }
+    CHECK(n == 5000);
+}
+
+} // namespace
+
+int main() {
+    testRandomOps();
+    testDeckBuild();
+    testDeckFitsWheel();
+    return dsa_test::finish("calendar_test");
+}
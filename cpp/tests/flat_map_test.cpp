@@ -0,0 +1,137 @@
+/* ═══════════════════════════════════════════════════════════════════
+   FlatQuestionMap — Swiss-table probing checked against unordered_map
+
+   Random put / overwrite / operator[] / remove over a bounded key set,
+   so tombstones pile up and both rebuild paths run (clean at the same
+   size, and double). Every step compares size and one lookup; every
+   so often the whole contents are compared with the reference. Also:
+   a moved-from map staying usable.
+   ═══════════════════════════════════════════════════════════════════ */
+
+#include "flat_question_map.h"
+#include "test_check.h"
+#include <random>
+#include <unordered_map>
+
+using namespace std;
+using namespace dsa;
+
+namespace {
+
+Question make(const string& id, const string& name) {
+    Question q;
+    q.id   = id;
+    q.name = name;
+    return q;
+}
+
+// key → name of the stored question
+using Reference = unordered_map<string, string>;
+
+void checkAll(const FlatQuestionMap& m, const Reference& ref) {
+    CHECK(m.size() == static_cast<int>(ref.size()));
+    vector<Question> all = m.getAllQuestions();
+    CHECK(all.size() == ref.size());
+    for (const auto& q : all) {
+        auto it = ref.find(q.id);
+        CHECK(it != ref.end() && it->second == q.name);
+    }
+    for (const auto& e : ref) {
+        pair<bool, Question> got = m.get(e.first);
+        CHECK(got.first && got.second.name == e.second);
+    }
+}
+
+void randomOps(FlatQuestionMap& m, unsigned seed, int keys, int steps) {
+    mt19937 rng(seed);
+    Reference ref;
+
+    for (int step = 0; step < steps; ++step) {
+        string key = "q" + to_string(rng() % keys);
+        string name = "v" + to_string(step);
+        int op = static_cast<int>(rng() % 10);
+
+        if (op < 5) {                       // insert or overwrite
+            m.put(key, make(key, name));
+            ref[key] = name;
+        } else if (op < 6) {                // insert-or-edit in place
+            Question& q = m[key];
+            q.id   = key;
+            q.name = name;
+            ref[key] = name;
+        } else {
+            bool had = ref.erase(key) > 0;
+            CHECK(m.remove(key) == had);
+        }
+
+        CHECK(m.size() == static_cast<int>(ref.size()));
+        string probe = "q" + to_string(rng() % keys);
+        auto it = ref.find(probe);
+        CHECK(m.contains(probe) == (it != ref.end()));
+        pair<bool, Question> got = m.get(probe);
+        CHECK(got.first == (it != ref.end()));
+        if (got.first && it != ref.end()) CHECK(got.second.name == it->second);
+
+        if (step % 2000 == 0) checkAll(m, ref);
+    }
+    checkAll(m, ref);
+
+    // drain to empty, then refill past the old size
+    for (const auto& e : ref) CHECK(m.remove(e.first));
+    ref.clear();
+    CHECK(m.empty());
+    for (int i = 0; i < keys * 2; ++i) {
+        string key = "r" + to_string(i);
+        m.put(key, make(key, key));
+        ref[key] = key;
+    }
+    checkAll(m, ref);
+}
+
+// ── Move leaves the source empty and usable ──
+void testMove() {
+    FlatQuestionMap a;
+    Reference ref;
+    for (int i = 0; i < 100; ++i) {
+        string key = "q" + to_string(i);
+        a.put(key, make(key, key));
+        ref[key] = key;
+    }
+
+    FlatQuestionMap b(move(a));
+    checkAll(b, ref);
+
+    CHECK(a.empty() && a.loadFactor() == 0.0);
+    CHECK(!a.contains("q1") && !a.find("q1") && !a.remove("q1"));
+    CHECK(!a.get("q1").first);
+
+    Reference fresh;
+    for (int i = 0; i < 200; ++i) {
+        string key = "n" + to_string(i);
+        a.put(key, make(key, key));
+        fresh[key] = key;
+    }
+    a["extra"].name = "extra";
+    fresh["extra"] = "extra";
+    CHECK(a.find("extra") && a.find("extra")->id.empty());
+    a.find("extra")->id = "extra";
+    checkAll(a, fresh);
+    checkAll(b, ref);
+}
+
+} // namespace
+
+int main() {
+    FlatQuestionMap small;                  // grows from INIT_CAP
+    randomOps(small, 11, 3000, 60000);
+
+    FlatQuestionMap sized(5000);            // churn at a fixed size: tombstone cleanups
+    randomOps(sized, 12, 4000, 60000);
+
+    FlatQuestionMap tiny;                   // a few keys, heavy remove / re-insert
+    randomOps(tiny, 13, 20, 20000);
+
+    testMove();
+
+    return dsa_test::finish("flat_map_test");
+}
@@ -0,0 +1,157 @@
+/* ═══════════════════════════════════════════════════════════════════
+   QuestionHashMap — incremental rehash checked against unordered_map
+
+   Random put / overwrite / operator[] / remove while the table keeps
+   growing, so most writes land while chains are still being spliced
+   from the old table. Lookups, entry iteration, copies taken mid-
+   migration and the secondary indexes are all compared with the
+   reference; an overwrite must never grow the table. Also: moved-from
+   maps staying usable.
+   ═══════════════════════════════════════════════════════════════════ */
+
+#include "question_hashmap.h"
+#include "test_check.h"
+#include <random>
+#include <unordered_map>
+
+using namespace std;
+using namespace dsa;
+
+namespace {
+
+struct Value {
+    string     name;
+    Difficulty difficulty;
+};
+
+using Reference = unordered_map<string, Value>;
+
+Question make(const string& id, const Value& v) {
+    Question q;
+    q.id         = id;
+    q.name       = v.name;
+    q.difficulty = v.difficulty;
+    return q;
+}
+
+void checkAll(const QuestionHashMap& m, const Reference& ref) {
+    CHECK(m.size() == static_cast<int>(ref.size()));
+
+    size_t seen = 0;
+    for (const auto& e : m) {
+        ++seen;
+        auto it = ref.find(e.first);
+        CHECK(it != ref.end() && it->second.name == e.second.name);
+    }
+    CHECK(seen == ref.size());
+
+    for (const auto& e : ref) {
+        const Question* q = m.find(e.first);
+        CHECK(q && q->name == e.second.name);
+    }
+}
+
+void checkIndexes(const QuestionHashMap& m, const Reference& ref) {
+    for (int d = 0; d < 3; ++d) {
+        size_t want = 0;
+        for (const auto& e : ref)
+            if (e.second.difficulty == static_cast<Difficulty>(d)) ++want;
+        CHECK(m.count(IndexQuery().withDifficulty(static_cast<Difficulty>(d))) == want);
+    }
+}
+
+void randomOps(bool indexed, unsigned seed) {
+    mt19937 rng(seed);
+    QuestionHashMap m;
+    if (indexed) m.enableIndexes();
+    Reference ref;
+    int keys = 100;
+
+    for (int step = 0; step < 80000; ++step) {
+        if (step % 1000 == 0) keys = min(keys * 2, 50000);   // keep the table growing
+        string key = "q" + to_string(rng() % keys);
+        Value v{"v" + to_string(step), static_cast<Difficulty>(rng() % 3)};
+        int op = static_cast<int>(rng() % 10);
+        bool had = ref.count(key) > 0;
+        double load = m.loadFactor();
+
+        if (op < 6) {                       // insert or overwrite
+            m.put(key, make(key, v));
+            ref[key] = v;
+            if (had) CHECK(m.loadFactor() == load);     // only inserts may grow the table
+        } else if (op < 7) {                // operator[] — name only, indexes untouched
+            Question& q = m[key];
+            if (had) CHECK(m.loadFactor() == load);
+            if (ref.count(key)) v.difficulty = ref[key].difficulty;
+            else { q.id = key; v.difficulty = q.difficulty; }
+            q.name = v.name;
+            ref[key] = v;
+        } else {
+            ref.erase(key);
+            CHECK(m.remove(key) == had);
+        }
+
+        CHECK(m.size() == static_cast<int>(ref.size()));
+        string probe = "q" + to_string(rng() % keys);
+        auto it = ref.find(probe);
+        CHECK(m.contains(probe) == (it != ref.end()));
+        pair<bool, Question> got = m.get(probe);
+        CHECK(got.first == (it != ref.end()));
+        if (got.first && it != ref.end()) CHECK(got.second.name == it->second.name);
+
+        if (step % 1500 == 0) {
+            checkAll(m, ref);
+            QuestionHashMap copy(m);        // copy of a table that may be mid-migration
+            checkAll(copy, ref);
+            if (indexed) checkIndexes(m, ref);
+        }
+    }
+    checkAll(m, ref);
+    if (indexed) checkIndexes(m, ref);
+
+    for (const auto& e : ref) CHECK(m.remove(e.first));
+    CHECK(m.empty());
+}
+
+// ── Move construction and assignment leave the source empty and usable ──
+void testMove() {
+    QuestionHashMap a;
+    Reference ref;
+    for (int i = 0; i < 100; ++i) {
+        string key = "q" + to_string(i);
+        Value v{key, Difficulty::EASY};
+        a.put(key, make(key, v));
+        ref[key] = v;
+    }
+
+    QuestionHashMap b(move(a));
+    checkAll(b, ref);
+    CHECK(a.empty() && a.loadFactor() == 0.0);
+    CHECK(!a.contains("q1") && !a.find("q1") && !a.remove("q1"));
+
+    QuestionHashMap c;
+    c = move(b);
+    checkAll(c, ref);
+    CHECK(b.empty() && b.loadFactor() == 0.0);
+
+    Reference fresh;
+    for (int i = 0; i < 200; ++i) {
+        string key = "n" + to_string(i);
+        Value v{key, Difficulty::HARD};
+        a.put(key, make(key, v));
+        b.put(key, make(key, v));
+        fresh[key] = v;
+    }
+    checkAll(a, fresh);
+    checkAll(b, fresh);
+    checkAll(c, ref);
+}
+
+} // namespace
+
+int main() {
+    randomOps(false, 15);
+    randomOps(true, 16);
+    testMove();
+    return dsa_test::finish("hashmap_test");
+}
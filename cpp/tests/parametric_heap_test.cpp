@@ -0,0 +1,168 @@
+/* ═══════════════════════════════════════════════════════════════════
+   ParametricRevisionHeap — day-independent keys checked by brute force
+
+   Questions are re-dated (past and future) and re-pushed, removed,
+   popped and listed while the day moves forward; each front / top-K
+   must match a scan of getPriorityScore(today) over the queued
+   questions due that day (score >= 0), and every so often the front
+   must be the day-bound RevisionHeap's. Run on a borrowed deck, built
+   with and without a day, and on an owning (default-built) heap.
+   Also: a deck dated entirely in the future, drained day by day.
+   ═══════════════════════════════════════════════════════════════════ */
+
+#include "parametric_revision_heap.h"
+#include "test_check.h"
+#include <cmath>
+#include <random>
+#include <set>
+
+using namespace std;
+using namespace dsa;
+
+namespace {
+
+const EpochDay BASE = EpochDay::fromCivil(2026, 1, 1);
+
+// rate × today + offset is re-associated — equal to the direct score up to rounding
+bool close(double a, double b) { return fabs(a - b) <= 1e-9 * max(1.0, fabs(b)); }
+
+void redate(mt19937& rng, Question& q) {
+    q.nextRevisionDate = BASE + (static_cast<int>(rng() % 200) - 100);
+    q.difficulty = static_cast<Difficulty>(rng() % 3);
+    q.easeFactor = 1.3 + (rng() % 1000000) / 1e6;
+    q.streak     = static_cast<int>(rng() % 6);
+    q.status     = rng() % 15 == 0 ? QuestionStatus::MASTERED : QuestionStatus::SOLVED;
+}
+
+bool schedulable(const Question& q) {
+    return q.status != QuestionStatus::MASTERED && !q.nextRevisionDate.empty();
+}
+
+bool dueOn(const Question& q, EpochDay today) { return q.getPriorityScore(today) >= 0; }
+
+enum class Build { OWNING, BORROWED, BORROWED_ON_DAY };
+
+void run(Build build) {
+    mt19937 rng(9);
+    vector<Question> store(2000);
+    for (size_t i = 0; i < store.size(); ++i) {
+        store[i].id   = "q" + to_string(i);
+        store[i].name = "n" + to_string(i);
+        redate(rng, store[i]);
+    }
+
+    EpochDay today = BASE;
+    ParametricRevisionHeap h = build == Build::OWNING   ? ParametricRevisionHeap()
+                             : build == Build::BORROWED ? ParametricRevisionHeap(store)
+                             :                            ParametricRevisionHeap(store, today);
+    set<int> queued;
+    for (size_t i = 0; i < store.size(); ++i) {
+        if (build == Build::OWNING) h.push(store[i]);
+        if (schedulable(store[i])) queued.insert(static_cast<int>(i));
+    }
+    CHECK(h.size() == static_cast<int>(queued.size()));
+
+    auto idOf = [](const Question& q) { return stoi(q.id.substr(1)); };
+    auto sortedScores = [&](EpochDay day) {
+        vector<double> s;
+        for (int i : queued)
+            if (dueOn(store[i], day)) s.push_back(store[i].getPriorityScore(day));
+        sort(s.begin(), s.end());
+        return s;
+    };
+
+    for (int step = 0; step < 20000; ++step) {
+        int op = static_cast<int>(rng() % 8);
+        int i  = static_cast<int>(rng() % store.size());
+
+        if (op < 3) {
+            redate(rng, store[i]);
+            bool want = schedulable(store[i]);
+            CHECK(h.push(store[i]) == want);
+            if (want) queued.insert(i); else queued.erase(i);
+        } else if (op == 3) {
+            bool had = queued.erase(i) > 0;
+            CHECK(h.remove(store[i].id) == had);
+        } else if (op < 6) {
+            vector<double> due = sortedScores(today);
+            CHECK(h.dueCount(today) == static_cast<int>(due.size()));
+            if (due.empty()) continue;
+            double best = due.front();
+            CHECK(close(h.top(today).priorityScore, best));
+            HeapEntry e = h.pop(today);
+            int got = idOf(e.question);
+            CHECK(queued.count(got) == 1 && dueOn(store[got], today));
+            CHECK(close(store[got].getPriorityScore(today), best));
+            queued.erase(got);
+        } else if (op == 6) {
+            vector<double> all = sortedScores(today);
+            vector<HeapEntry> top = h.topK(7, today);
+            CHECK(top.size() == min<size_t>(7, all.size()));
+            for (size_t k = 0; k < top.size() && k < all.size(); ++k)
+                CHECK(close(top[k].priorityScore, all[k]));
+        } else {
+            today = today + static_cast<int>(rng() % 5);
+        }
+
+        CHECK(h.size() == static_cast<int>(queued.size()));
+        if (step % 1000 == 0) {
+            CHECK(h.isValidHeap());
+            vector<Question> live;
+            for (int i : queued) live.push_back(store[i]);
+            RevisionHeap dayBound(live, today);
+            CHECK(h.dueCount(today) == dayBound.size());
+            if (!dayBound.empty())
+                CHECK(close(h.top(today).priorityScore, dayBound.top().priorityScore));
+        }
+    }
+}
+
+// ── Nothing due yet: each question surfaces on its first due day ──
+void testFutureDated() {
+    mt19937 rng(10);
+    vector<Question> deck(1000);
+    for (size_t i = 0; i < deck.size(); ++i) {
+        deck[i].id = "q" + to_string(i);
+        deck[i].status = QuestionStatus::SOLVED;
+        deck[i].difficulty = static_cast<Difficulty>(rng() % 3);
+        deck[i].easeFactor = 1.3 + (rng() % 1000000) / 1e6;
+        deck[i].streak = static_cast<int>(rng() % 6);
+        deck[i].nextRevisionDate = BASE + 1 + static_cast<int>(rng() % 60);
+    }
+
+    EpochDay before = BASE - 10;
+    ParametricRevisionHeap h(deck);
+    CHECK(h.size() == 1000);
+    CHECK(h.dueCount(before) == 0);
+    CHECK(h.topK(5, before).empty());
+    bool threw = false;
+    try { h.top(before); } catch (const runtime_error&) { threw = true; }
+    CHECK(threw);
+
+    set<string> popped;
+    for (EpochDay day = before; day <= BASE + 61; day = day + 1) {
+        vector<Question> left;
+        for (const auto& q : deck)
+            if (!popped.count(q.id)) left.push_back(q);
+        RevisionHeap dayBound(left, day);
+        CHECK(h.dueCount(day) == dayBound.size());
+        if (!dayBound.empty())
+            CHECK(close(h.top(day).priorityScore, dayBound.top().priorityScore));
+        while (h.dueCount(day) > 0) {
+            HeapEntry e = h.pop(day);
+            CHECK(e.priorityScore >= 0 && ParametricRevisionHeap::firstDueDay(e.question) == day.days);
+            CHECK(popped.insert(e.question.id).second);
+        }
+    }
+    CHECK(popped.size() == deck.size() && h.empty());
+}
+
+} // namespace
+
+int main() {
+    run(Build::BORROWED);
+    run(Build::BORROWED_ON_DAY);
+    run(Build::OWNING);
+    testFutureDated();
+    return dsa_test::finish("parametric_heap_test");
+}
@@ -0,0 +1,116 @@
+/* ═══════════════════════════════════════════════════════════════════
+   RevisionHeap — addressable heap checked against an id → score map
+
+   Random push / re-score / updatePriority (including re-keyed ids) /
+   remove / pop over a bounded id set, so the id table fills, deletes
+   shift entries back and removed ids come back. Every pop and top-K
+   must match the smallest scores in the reference.
+   ═══════════════════════════════════════════════════════════════════ */
+
+#include "revision_heap.h"
+#include "test_check.h"
+#include <map>
+#include <random>
+
+using namespace std;
+using namespace dsa;
+
+namespace {
+
+const EpochDay BASE = EpochDay::fromCivil(2026, 1, 1);
+
+Question make(mt19937& rng, const string& id) {
+    Question q;
+    q.id = id;
+    q.name = "n" + id;
+    q.status = QuestionStatus::SOLVED;
+    q.nextRevisionDate = BASE + (static_cast<int>(rng() % 120) - 60);
+    q.difficulty = static_cast<Difficulty>(rng() % 3);
+    q.easeFactor = 1.3 + (rng() % 1000000) / 1e6;
+    q.streak = static_cast<int>(rng() % 6);
+    return q;
+}
+
+// id → score it was queued with
+using Reference = map<string, double>;
+
+vector<double> sortedScores(const Reference& ref) {
+    vector<double> s;
+    for (const auto& e : ref) s.push_back(e.second);
+    sort(s.begin(), s.end());
+    return s;
+}
+
+void randomOps(unsigned seed, int ids) {
+    mt19937 rng(seed);
+    RevisionHeap h;
+    Reference ref;
+    EpochDay today = BASE;
+
+    for (int step = 0; step < 40000; ++step) {
+        string id = "q" + to_string(rng() % ids);
+        int op = static_cast<int>(rng() % 12);
+
+        if (op < 4) {                       // push: new id or re-score in place
+            Question q = make(rng, id);
+            h.push(q, today);
+            ref[id] = q.getPriorityScore(today);
+        } else if (op < 6) {                // updatePriority, same id
+            Question q = make(rng, id);
+            h.updatePriority(id, q, today);
+            ref[id] = q.getPriorityScore(today);
+        } else if (op < 7) {                // updatePriority under a new id
+            string to = "q" + to_string(rng() % ids);
+            Question q = make(rng, to);
+            h.updatePriority(id, q, today);
+            ref.erase(id);
+            ref[to] = q.getPriorityScore(today);
+        } else if (op < 9) {
+            bool had = ref.erase(id) > 0;
+            CHECK(h.remove(id) == had);
+        } else if (op < 11) {
+            if (ref.empty()) continue;
+            double best = sortedScores(ref).front();
+            CHECK(h.top().priorityScore == best);
+            HeapEntry e = h.pop();
+            CHECK(e.priorityScore == best);
+            auto it = ref.find(e.question.id);
+            CHECK(it != ref.end() && it->second == e.priorityScore);
+            if (it != ref.end()) ref.erase(it);
+        } else {
+            today = today + static_cast<int>(rng() % 3);
+        }
+
+        CHECK(h.size() == static_cast<int>(ref.size()));
+        string probe = "q" + to_string(rng() % ids);
+        CHECK(h.contains(probe) == (ref.count(probe) > 0));
+
+        if (step % 1000 == 0) {
+            CHECK(h.isValidHeap());
+            vector<double> all = sortedScores(ref);
+            vector<HeapEntry> top = h.topK(10);
+            CHECK(top.size() == min<size_t>(10, all.size()));
+            for (size_t k = 0; k < top.size() && k < all.size(); ++k)
+                CHECK(top[k].priorityScore == all[k]);
+        }
+    }
+
+    // drain: scores come out in order, every id exactly once
+    double last = -1e300;
+    while (!h.empty()) {
+        HeapEntry e = h.pop();
+        CHECK(e.priorityScore >= last);
+        last = e.priorityScore;
+        CHECK(ref.erase(e.question.id) == 1);
+    }
+    CHECK(ref.empty());
+}
+
+} // namespace
+
+int main() {
+    randomOps(18, 500);       // dense ids: most ops hit a queued id
+    randomOps(19, 20000);     // sparse ids: the id table grows
+    randomOps(20, 8);         // a handful of ids: constant remove / re-insert
+    return dsa_test::finish("revision_heap_test");
+}
@@ -0,0 +1,41 @@
+/* ═══════════════════════════════════════════════════════════════════
+   DSA Tracker — Minimal Check Harness for tests/
+
+   Every tests/<name>_test.cpp is a standalone program (make test
+   builds and runs them all). CHECK records a failure and keeps
+   going; the first few are printed with file:line. finish() prints
+   the suite summary and returns the exit code for main().
+   ═══════════════════════════════════════════════════════════════════ */
+
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+#include <iostream>
+
+namespace dsa_test {
+
+static constexpr int MAX_REPORTED = 10;
+
+inline int& checks()   { static int n = 0; return n; }
+inline int& failures() { static int n = 0; return n; }
+
+inline void fail(const char* file, int line, const char* expr) {
+    if (++failures() <= MAX_REPORTED)
+        std::cerr << "  FAIL " << file << ":" << line << " — " << expr << "\n";
+}
+
+inline int finish(const char* suite) {
+    std::cout << "  " << suite << ": " << checks() << " checks, "
+              << failures() << " failed\n";
+    return failures() ? 1 : 0;
+}
+
+} // namespace dsa_test
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        ++dsa_test::checks();                                          \
+        if (!(cond)) dsa_test::fail(__FILE__, __LINE__, #cond);        \
+    } while (0)
+
+#endif // TEST_CHECK_H
@@ -0,0 +1,158 @@
+/* ═══════════════════════════════════════════════════════════════════
+   QuestionTrie — radix layout checked against a plain word → hits map
+
+   Random inserts / removes over a small alphabet (so edges split and
+   merge often), mixed case, then every query compared with a brute-
+   force answer. Also: labels longer than one edge, and a moved-from
+   trie staying usable.
+   ═══════════════════════════════════════════════════════════════════ */
+
+#include "question_trie.h"
+#include "test_check.h"
+#include <map>
+#include <random>
+
+using namespace std;
+using namespace dsa;
+
+namespace {
+
+string lower(string s) {
+    for (char& c : s) c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+    return s;
+}
+
+bool hasPrefix(const string& w, const string& p) { return w.compare(0, p.size(), p) == 0; }
+
+int levenshtein(const string& a, const string& b) {
+    vector<int> row(b.size() + 1);
+    for (size_t j = 0; j <= b.size(); ++j) row[j] = static_cast<int>(j);
+    for (size_t i = 1; i <= a.size(); ++i) {
+        int diag = row[0];
+        row[0] = static_cast<int>(i);
+        for (size_t j = 1; j <= b.size(); ++j) {
+            int up = row[j];
+            row[j] = min({row[j] + 1, row[j - 1] + 1, diag + (a[i - 1] != b[j - 1])});
+            diag = up;
+        }
+    }
+    return row[b.size()];
+}
+
+// word → times inserted, keyed lower-case like the trie
+using Reference = map<string, int>;
+
+void checkPrefix(const QuestionTrie& t, const Reference& ref, const string& prefix) {
+    string p = lower(prefix);
+    int count = 0;
+    bool any = false;
+    vector<string> first;
+    for (auto it = ref.lower_bound(p); it != ref.end() && hasPrefix(it->first, p); ++it) {
+        count += it->second;
+        any = true;
+        if (first.size() < 5) first.push_back(it->first);
+    }
+    CHECK(t.countWithPrefix(prefix) == count);
+    if (!p.empty()) CHECK(t.startsWith(prefix) == any);
+    CHECK(t.autocomplete(prefix, 5) == first);
+}
+
+void checkFuzzy(const QuestionTrie& t, const Reference& ref, const string& target, int maxDist) {
+    string low = lower(target);
+    vector<pair<string, int>> want;
+    for (const auto& e : ref) {
+        if (e.first.empty()) continue;          // the search starts below the root
+        int d = levenshtein(e.first, low);
+        if (d <= maxDist) want.emplace_back(e.first, d);
+    }
+    stable_sort(want.begin(), want.end(),
+                [](const pair<string, int>& a, const pair<string, int>& b) { return a.second < b.second; });
+    CHECK(t.fuzzySearch(target, maxDist) == want);
+}
+
+string randomWord(mt19937& rng, size_t maxLen) {
+    static const char ALPHABET[] = "abcAB";
+    string w(rng() % (maxLen + 1), 'a');
+    for (char& c : w) c = ALPHABET[rng() % 5];
+    return w;
+}
+
+// ── Random insert / remove against the reference ──
+void testRandomOps() {
+    mt19937 rng(25);
+    QuestionTrie t;
+    Reference ref;
+
+    for (int step = 0; step < 20000; ++step) {
+        string w = randomWord(rng, 7);
+        if (rng() % 10 < 7) {
+            t.insert(w, "q" + to_string(step));
+            ref[lower(w)]++;
+        } else {
+            bool had = ref.erase(lower(w)) > 0;
+            CHECK(t.removeWord(w) == had);
+        }
+
+        CHECK(t.getTotalWords() == static_cast<int>(ref.size()));
+        string probe = randomWord(rng, 7);
+        CHECK(t.search(probe) == (ref.count(lower(probe)) > 0));
+        checkPrefix(t, ref, randomWord(rng, 4));
+
+        if (step % 1000 == 0) {
+            for (const auto& e : ref) CHECK(t.search(e.first));
+            checkPrefix(t, ref, "");
+            checkFuzzy(t, ref, randomWord(rng, 6), 1);
+            checkFuzzy(t, ref, randomWord(rng, 6), 2);
+        }
+    }
+}
+
+// ── Labels past MAX_LABEL become a chain of edges ──
+void testLongWords() {
+    QuestionTrie t;
+    string longWord(70000, 'x');
+    longWord += "yz";
+    t.insert(longWord, "long");
+    t.insert(longWord.substr(0, 65536), "cut");
+    CHECK(t.search(longWord));
+    CHECK(t.search(longWord.substr(0, 65536)));
+    CHECK(!t.search(longWord.substr(0, 65535)));
+    CHECK(t.countWithPrefix(string(65540, 'x')) == 1);
+    CHECK(t.countWithPrefix("xxx") == 2);
+    CHECK(t.removeWord(longWord));
+    CHECK(t.countWithPrefix("xxx") == 1);
+    CHECK(t.getTotalWords() == 1);
+}
+
+// ── Move leaves the source an empty, working trie ──
+void testMove() {
+    QuestionTrie a;
+    a.insert("Binary Search", "q1");
+    a.insert("Binary Tree", "q2");
+
+    QuestionTrie b(move(a));
+    CHECK(b.getTotalWords() == 2);
+    CHECK(b.countWithPrefix("binary") == 2);
+
+    CHECK(a.getTotalWords() == 0);
+    CHECK(a.countWithPrefix("") == 0);
+    CHECK(!a.search("binary search"));
+    CHECK(a.autocomplete("").empty());
+    CHECK(a.fuzzySearch("binary", 2).empty());
+    CHECK(!a.removeWord("binary tree"));
+
+    a.insert("Graph", "q3");
+    CHECK(a.search("graph"));
+    CHECK(a.countWithPrefix("g") == 1);
+    CHECK(a.autocomplete("gr") == vector<string>{"graph"});
+    CHECK(!b.search("graph"));
+}
+
+} // namespace
+
+int main() {
+    testRandomOps();
+    testLongWords();
+    testMove();
+    return dsa_test::finish("trie_test");
+}